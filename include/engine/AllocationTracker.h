@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * AllocationTracker: opt-in instrumentation that counts every operator new/delete
+ *
+ * Why: We want steady-state frames to never touch the heap. Allocations hide in innocent looking
+ * code (hash map inserts, std::set nodes, std::function captures...), so instead of guessing we
+ * replace the global operator new/delete and count calls and bytes per frame phase.
+ *
+ * Build flags (see CMakeLists.txt):
+ * - ENGINE_TRACK_ALLOCATIONS: count allocations and print a report on exit
+ * - ENGINE_ALLOCATION_AUDIT:  also assert when a frame allocates after warm-up
+ *
+ * With neither flag defined every function below is an empty inline, so release builds pay nothing.
+ *
+ * Usage:
+ *   Engine::AllocationTracker::SetPhase(Engine::FramePhase::Render); // everything this thread allocates now counts as Render
+ *   ...
+ *   Engine::AllocationTracker::EndFrame();                            // once per frame, after all phases are done
+ *   Engine::AllocationTracker::Report();                              // on shutdown
+ */
+
+#if defined(ENGINE_ALLOCATION_AUDIT) && !defined(ENGINE_TRACK_ALLOCATIONS)
+#define ENGINE_TRACK_ALLOCATIONS
+#endif
+
+namespace Engine
+{
+  // FramePhase labels what part of the frame an allocation came from.
+  enum class FramePhase : std::uint8_t
+  {
+    Startup,     // Anything before the game loop (and threads that never set a phase)
+    Events,      // Event polling and input sampling
+    Simulation,  // Game::Update and the jobs it schedules
+    Render,      // Game::Render on the main thread
+    Diagnostics, // Debug logging; reported but never counted against the steady-state audit
+    Maintenance, // Deliberate housekeeping (Coordinator::Shrink); reported but not counted either
+    Count
+  };
+
+  // PhaseStats is a snapshot of the counters for one phase.
+  struct PhaseStats
+  {
+    std::uint64_t allocations{};
+    std::uint64_t deallocations{};
+    std::uint64_t bytes{};
+  };
+
+  namespace AllocationTracker
+  {
+    // Frames to skip before the audit starts complaining (containers are still growing to their working size)
+    constexpr std::uint64_t WARMUP_FRAMES = 300;
+
+#ifdef ENGINE_TRACK_ALLOCATIONS
+    void SetPhase(FramePhase phase);       // Set the phase for the calling thread
+    FramePhase GetPhase();                 // Phase of the calling thread
+    void EndFrame();                       // Close the current frame (audit check happens here)
+    PhaseStats GetStats(FramePhase phase); // Totals since startup for a phase
+    void Report();                         // Print totals and the number of frames that allocated after warm-up
+#else
+    inline void SetPhase(FramePhase) {}
+    inline FramePhase GetPhase() { return FramePhase::Startup; }
+    inline void EndFrame() {}
+    inline PhaseStats GetStats(FramePhase) { return {}; }
+    inline void Report() {}
+#endif
+
+    // ScopedPhase switches the calling thread to a phase and restores the previous one when it goes out of scope.
+    class ScopedPhase
+    {
+    public:
+      explicit ScopedPhase(FramePhase phase) : _previous(GetPhase()) { SetPhase(phase); }
+      ~ScopedPhase() { SetPhase(_previous); }
+
+      ScopedPhase(const ScopedPhase &) = delete;
+      ScopedPhase &operator=(const ScopedPhase &) = delete;
+
+    private:
+      FramePhase _previous;
+    };
+  }
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+
+#include "Vec2.h"
+
+namespace Engine
+{
+  /**
+   * Camera - Maps world coordinates (where entities live) to screen coordinates (where they're drawn)
+   *
+   * Why: Using Transform::position as a screen position caps the world at the window size.
+   * With a camera the world can be any size: the camera looks at a point, and only the part of
+   * the world around it (scaled by zoom) ends up on screen.
+   *
+   *   screen = (world - viewTopLeft) * zoom      world = screen / zoom + viewTopLeft
+   *
+   * - Follow() eases toward a target (frame-rate independent), SnapTo() jumps there
+   * - SetBounds() keeps the view inside the world, so the edge of the map stays on the edge of the screen
+   *
+   * A Camera is a small value type: copy it to hand a consistent view to another thread.
+   */
+  class Camera
+  {
+  public:
+    static constexpr float MIN_ZOOM = 0.25f;
+    static constexpr float MAX_ZOOM = 4.0f;
+
+    Camera() = default;
+    explicit Camera(Vec2 viewportSize);
+
+    Vec2 WorldToScreen(const Vec2 &world) const;
+    Vec2 ScreenToWorld(const Vec2 &screen) const;
+    SDL_FRect GetWorldView() const; // The part of the world that is on screen
+
+    void Follow(const Vec2 &target, float dt); // Ease toward target
+    void SnapTo(const Vec2 &target);
+    void ZoomBy(float factor);                 // Multiply zoom, clamped to [MIN_ZOOM, MAX_ZOOM]
+    void SetBounds(const SDL_FRect &worldBounds);
+
+    Vec2 GetPosition() const { return _position; }
+    float GetZoom() const { return _zoom; }
+    Vec2 GetViewportSize() const { return _viewportSize; }
+
+  private:
+    void ClampToBounds();
+
+    Vec2 _position;                // World point at the centre of the screen
+    float _zoom = 1.0f;            // Screen pixels per world unit
+    Vec2 _viewportSize;            // Screen size in pixels
+    SDL_FRect _bounds{};           // World area the view stays inside (w/h = 0: unbounded)
+    float _followSharpness = 8.0f; // Higher = catches up faster (1/seconds)
+  };
+}
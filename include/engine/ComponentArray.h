@@ -1,13 +1,31 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
-#include <unordered_map>
+#include <bit>
 #include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "Types.h"
+#include "Snapshot.h"
 
 namespace Engine
 {
+  // ComponentMemory is what one component array holds on the heap right now, and the most it ever held.
+  struct ComponentMemory
+  {
+    size_t denseBytes;  // Packed components + their owners (grows with the component count)
+    size_t sparseBytes; // Entity → index lookup (MAX_ENTITIES entries once the type has ever been used, else none)
+    size_t peakBytes;   // Highest dense + sparse total so far
+  };
+
   /*
    * Why we need this: ComponentArray<Transform> and ComponentArray<Velocity> are different types,
    * but we want to store them in the same container. This interface lets us do that.
@@ -17,10 +35,24 @@ namespace Engine
   public:
     virtual ~IComponentArray() = default;
     virtual void EntityDestroyed(Entity entity) = 0;
+    virtual void AddElementBytes(Entity entity, const std::byte *component) = 0; // Add a component from its raw bytes (spawn templates)
+    virtual size_t IndexOf(Entity entity) const = 0;           // Packed index of the entity's component (MAX_ENTITIES if it has none)
+    virtual Entity EntityAt(size_t index) const = 0;           // Which entity owns a packed slot
+    virtual size_t Size() const = 0;                           // Number of components in the array
+    virtual size_t Capacity() const = 0;                       // Number of components the array can hold before it grows
+    virtual void SwapElements(size_t a, size_t b) = 0;         // Swap two packed slots (groups use this to keep arrays co-sorted)
+    virtual ComponentMemory GetMemoryUsage() const = 0;        // Heap bytes held now, and the peak
+    virtual void Shrink() = 0;                                 // Give back capacity left over from a spike
+    virtual void Serialize(SnapshotWriter &writer) const = 0;  // Write every component (and who owns it) into a snapshot
+    virtual bool Deserialize(SnapshotReader &reader) = 0;      // Replace all components with the ones stored in a snapshot
   };
 
   /* ComponentArray: Stores all components of a single type (e.g. all Transforms)
    * Why packed arrays? Cache performance. Keeping data tightly packed means faster iteration.
+   *
+   * The packed data grows with use, not with MAX_ENTITIES: it doubles when it fills up. The entity → index
+   * lookup stays one flat array (it's on every GetData()), but is only allocated once the type is first used.
+   * Nothing is freed on removal (so steady churn never touches the heap); Shrink() gives the excess back.
    */
   template <typename T>
   class ComponentArray : public IComponentArray
@@ -30,59 +62,198 @@ namespace Engine
     void RemoveElement(Entity entity);                   // remove a component from an entity (uses swap-and-pop)
     T &GetData(Entity entity);                           // get a component from an entity
     void EntityDestroyed(Entity entity) override;        // remove a component from an entity when it is destroyed
+    void AddElementBytes(Entity entity, const std::byte *component) override;
+    size_t IndexOf(Entity entity) const override;
+    Entity EntityAt(size_t index) const override { return _indexToEntity[index]; }
+    size_t Size() const override { return _size; }
+    size_t Capacity() const override { return _componentArray.capacity(); }
+    void SwapElements(size_t a, size_t b) override;
+    ComponentMemory GetMemoryUsage() const override;
+    void Shrink() override;                              // Halve (or better) the packed capacity if it's mostly unused, and free an unused lookup
+    T *GetPackedData() { return _componentArray.data(); }                    // Components in packed order (first Size() are valid)
+    const Entity *GetPackedEntities() const { return _indexToEntity.data(); } // Owner of each packed slot
+    void Serialize(SnapshotWriter &writer) const override;
+    bool Deserialize(SnapshotReader &reader) override;
 
   private:
-    std::array<T, MAX_COMPONENTS> _componentArray{};     // The actual component data, stored contiguously for cache performance
+    static constexpr size_t INVALID_INDEX = MAX_ENTITIES;   // Marks an entity that has no component in this array
+    static constexpr size_t MIN_CAPACITY = 64;              // Smallest packed allocation (avoids regrowing through 1, 2, 4...)
+    using SparseIndex = std::uint32_t;                      // Holds any packed index (and INVALID_INDEX) in half the space of size_t
+    static_assert(MAX_ENTITIES <= UINT32_MAX, "Packed indices no longer fit in SparseIndex");
 
-    std::unordered_map<Entity, size_t> _entityToIndex{}; // Map: entity ID → array index
-                                                         // Why: Quickly find where an entity's component is stored
+    SparseIndex &SparseSlot(Entity entity);                 // The entity's index slot, allocating the lookup if needed
+    size_t AppendSlot(Entity entity);                       // Map the entity to a new slot at the end (zeroed, or value-initialized if not trivially copyable)
+    void Reserve(size_t capacity);                          // Reallocate both packed vectors to exactly `capacity`
+    void UpdatePeak();
 
-    std::unordered_map<size_t, Entity> _indexToEntity{}; // Map: array index → entity ID
-                                                         // Why: When we remove a component, we need to know which entity we moved
+    std::vector<T> _componentArray;                         // The actual component data, stored contiguously for cache performance
 
-    size_t _size{};                                      // Total count of active components
-                                                         // Why track this? The array is fixed size, but only the first _size elements are valid
+    std::unique_ptr<SparseIndex[]> _entityToIndex;          // Map: entity ID → array index (INVALID_INDEX if missing), MAX_ENTITIES long
+                                                            // Why: Quickly find where an entity's component is stored
+                                                            // Why an array and not a hash map? Entity IDs are dense (0..MAX_ENTITIES),
+                                                            // so a flat lookup is faster and never allocates on insert
+                                                            // Why not paged? The extra indirection cost ~10% of simulation time;
+                                                            // null until first use, so types nobody has cost nothing
+
+    std::vector<Entity> _indexToEntity;                     // Map: array index → entity ID
+                                                            // Why: When we remove a component, we need to know which entity we moved
+
+    size_t _size{};                                         // Total count of active components (same as both vectors' size)
+    size_t _peakBytes{};                                    // Highest GetMemoryUsage() total so far
   };
 
   // =======================================================
 
   template <typename T>
-  void ComponentArray<T>::AddElement(Entity entity, const T &component)
+  typename ComponentArray<T>::SparseIndex &ComponentArray<T>::SparseSlot(Entity entity)
   {
-    assert(_entityToIndex.find(entity) == _entityToIndex.end() && "Trying to add a component to the same entity more than once");
+    if (!_entityToIndex)
+    {
+      _entityToIndex = std::make_unique_for_overwrite<SparseIndex[]>(MAX_ENTITIES);
+      std::fill_n(_entityToIndex.get(), MAX_ENTITIES, static_cast<SparseIndex>(INVALID_INDEX)); // Every entity starts without this component
+      UpdatePeak();
+    }
+    return _entityToIndex[entity];
+  }
+
+  template <typename T>
+  size_t ComponentArray<T>::IndexOf(Entity entity) const
+  {
+    return _entityToIndex ? _entityToIndex[entity] : INVALID_INDEX;
+  }
+
+  template <typename T>
+  void ComponentArray<T>::Reserve(size_t capacity)
+  {
+    // Move into exactly-sized vectors (reserve() can't shrink, and shrink_to_fit() is only a request)
+    std::vector<T> components;
+    std::vector<Entity> entities;
+    components.reserve(capacity);
+    entities.reserve(capacity);
+    components.assign(std::make_move_iterator(_componentArray.begin()), std::make_move_iterator(_componentArray.end()));
+    entities.assign(_indexToEntity.begin(), _indexToEntity.end());
+
+    _componentArray.swap(components);
+    _indexToEntity.swap(entities);
+    UpdatePeak();
+  }
+
+  template <typename T>
+  void ComponentArray<T>::UpdatePeak()
+  {
+    const auto usage = GetMemoryUsage();
+    _peakBytes = std::max(_peakBytes, usage.denseBytes + usage.sparseBytes);
+  }
+
+  template <typename T>
+  size_t ComponentArray<T>::AppendSlot(Entity entity)
+  {
+    if (_size == _componentArray.capacity())
+    {
+      Reserve(std::max(MIN_CAPACITY, _size * 2)); // Grow both vectors together, by doubling
+    }
 
     size_t newIndex = _size;               // Put new entry at end
 
-    _entityToIndex[entity] = newIndex;     // Update entity → index mapping
-    _indexToEntity[newIndex] = entity;     // Update index → entity mapping
-    _componentArray[newIndex] = component; // Store the actual component data
+    SparseSlot(entity) = static_cast<SparseIndex>(newIndex); // Update entity → index mapping
+    _indexToEntity.push_back(entity);      // Update index → entity mapping
+    _componentArray.emplace_back();
+    if constexpr (std::is_trivially_copyable_v<T>)
+    {
+      std::memset(static_cast<void *>(&_componentArray.back()), 0, sizeof(T)); // Padding and a tag's one byte are never written otherwise,
+    }                                                                         // and snapshots copy them: keep them zero, like a fresh array
 
     ++_size;                               // Increment size to account for new component
+    return newIndex;
+  }
+
+  template <typename T>
+  void ComponentArray<T>::AddElement(Entity entity, const T &component)
+  {
+    assert(entity < MAX_ENTITIES && "Entity is out of range.");
+    assert(IndexOf(entity) == INVALID_INDEX && "Trying to add a component to the same entity more than once");
+
+    // `component` may live in this array, and growing moves it: stage a copy before appending
+    if constexpr (std::is_empty_v<T>)
+    {
+      AppendSlot(entity);
+    }
+    else if constexpr (std::is_trivially_copyable_v<T>)
+    {
+      std::array<std::byte, sizeof(T)> bytes;                                // Raw bytes, padding included,
+      std::memcpy(bytes.data(), &component, sizeof(T));                      // so snapshots come out the same
+      std::memcpy(&_componentArray[AppendSlot(entity)], bytes.data(), sizeof(T)); // as a plain assignment
+    }
+    else
+    {
+      T copy = component;
+      _componentArray[AppendSlot(entity)] = std::move(copy); // Store the actual component data
+    }
+  }
+
+  template <typename T>
+  void ComponentArray<T>::AddElementBytes(Entity entity, const std::byte *component)
+  {
+    assert(entity < MAX_ENTITIES && "Entity is out of range.");
+    assert(IndexOf(entity) == INVALID_INDEX && "Trying to add a component to the same entity more than once");
+
+    if constexpr (std::is_trivially_copyable_v<T>)
+    {
+      size_t newIndex = AppendSlot(entity);
+      if constexpr (!std::is_empty_v<T>) // Tags have no state, and their one byte of storage is garbage
+      {
+        std::memcpy(&_componentArray[newIndex], component, sizeof(T)); // Straight from the template's byte image
+      }
+    }
+    else
+    {
+      assert(false && "Only trivially copyable components can come from a spawn template");
+    }
   }
 
   template <typename T>
   void ComponentArray<T>::RemoveElement(Entity entity)
   {
-    assert(_entityToIndex.find(entity) != _entityToIndex.end() && "You can not remove an entity that doesn't exist");
+    assert(entity < MAX_ENTITIES && "Entity is out of range.");
+    assert(IndexOf(entity) != INVALID_INDEX && "You can not remove an entity that doesn't exist");
 
-    size_t removeIndex = _entityToIndex[entity];               // Find where the removed component is
-    size_t lastIndex = _size - 1;                              // Find the last component in the array
-    _componentArray[removeIndex] = _componentArray[lastIndex]; // Move last component into the gap
+    SparseIndex &removeSlot = SparseSlot(entity);
+    size_t removeIndex = removeSlot;                                      // Find where the removed component is
+    size_t lastIndex = _size - 1;                                         // Find the last component in the array
+    if (removeIndex != lastIndex)
+    {
+      _componentArray[removeIndex] = std::move(_componentArray[lastIndex]); // Move last component into the gap
+    }
 
-    Entity lastEntity = _indexToEntity[lastIndex];             // Get the entity that was at the last position
-    _entityToIndex[lastEntity] = removeIndex;                  // Update its mapping to point to the new location
-    _indexToEntity[removeIndex] = lastEntity;                  // Update reverse mapping
+    Entity lastEntity = _indexToEntity[lastIndex];                        // Get the entity that was at the last position
+    SparseSlot(lastEntity) = static_cast<SparseIndex>(removeIndex);       // Update its mapping to point to the new location
+    _indexToEntity[removeIndex] = lastEntity;                             // Update reverse mapping
 
-    _entityToIndex.erase(entity);                              // Clean up the removed entity's entry
-    _indexToEntity.erase(lastIndex);                           // Clean up the old last index entry
+    removeSlot = INVALID_INDEX;                                           // Clean up the removed entity's entry
+
+    _componentArray.pop_back();                                           // One fewer active component (capacity stays)
+    _indexToEntity.pop_back();
+    --_size;
+  }
+
+  template <typename T>
+  void ComponentArray<T>::SwapElements(size_t a, size_t b)
+  {
+    assert(a < _size && b < _size && "Index is out of range.");
+    if (a == b)
+      return;
 
-    --_size;                                                   // One fewer active component
+    std::swap(_componentArray[a], _componentArray[b]);
+    std::swap(_indexToEntity[a], _indexToEntity[b]);
+    _entityToIndex[_indexToEntity[a]] = static_cast<SparseIndex>(a); // Both have a component, so the lookup exists
+    _entityToIndex[_indexToEntity[b]] = static_cast<SparseIndex>(b);
   }
 
   template <typename T>
   T &ComponentArray<T>::GetData(Entity entity)
   {
-    assert(_entityToIndex.find(entity) != _entityToIndex.end() && "You can't request data from an entity that doesn't exist");
+    assert(entity < MAX_ENTITIES && "Entity is out of range.");
+    assert(IndexOf(entity) != INVALID_INDEX && "You can't request data from an entity that doesn't exist");
 
     return _componentArray[_entityToIndex[entity]]; // Look up the index and return the component data
   }
@@ -90,9 +261,88 @@ namespace Engine
   template <typename T>
   void ComponentArray<T>::EntityDestroyed(Entity entity)
   {
-    if (_entityToIndex.find(entity) != _entityToIndex.end())
+    if (IndexOf(entity) != INVALID_INDEX)
     {
       RemoveElement(entity);
     }
   }
+
+  template <typename T>
+  ComponentMemory ComponentArray<T>::GetMemoryUsage() const
+  {
+    return {.denseBytes = _componentArray.capacity() * sizeof(T) + _indexToEntity.capacity() * sizeof(Entity),
+            .sparseBytes = _entityToIndex ? MAX_ENTITIES * sizeof(SparseIndex) : 0,
+            .peakBytes = _peakBytes};
+  }
+
+  template <typename T>
+  void ComponentArray<T>::Shrink()
+  {
+    // Keep power-of-two headroom above the current size, and only reallocate when that at least halves
+    // the capacity: a count hovering around a boundary shouldn't shrink and regrow every time
+    size_t target = _size == 0 ? 0 : std::max(MIN_CAPACITY, std::bit_ceil(_size));
+    if (target * 2 <= _componentArray.capacity())
+    {
+      Reserve(target);
+    }
+
+    if (_size == 0)
+    {
+      _entityToIndex.reset(); // Nobody has this component any more: don't keep a lookup for it
+    }
+  }
+
+  // Layout: uint32 sizeof(T), uint32 count, Entity[count], T[count] (via ComponentSerializer<T>)
+  template <typename T>
+  void ComponentArray<T>::Serialize(SnapshotWriter &writer) const
+  {
+    writer.Write(static_cast<std::uint32_t>(sizeof(T)));                  // Lets Deserialize catch a changed struct layout
+    writer.Write(static_cast<std::uint32_t>(_size));
+    writer.WriteBytes(_indexToEntity.data(), _size * sizeof(Entity));     // Which entity owns each packed slot
+    ComponentSerializer<T>::Write(writer, std::span<const T>(_componentArray.data(), _size)); // The packed data itself (bulk copy by default)
+  }
+
+  template <typename T>
+  bool ComponentArray<T>::Deserialize(SnapshotReader &reader)
+  {
+    std::uint32_t componentSize = 0;
+    std::uint32_t count = 0;
+    if (!reader.Read(componentSize) || componentSize != sizeof(T) || !reader.Read(count) || count > MAX_ENTITIES)
+      return false;
+
+    // Forget the current contents
+    if (_entityToIndex)
+    {
+      std::fill_n(_entityToIndex.get(), MAX_ENTITIES, static_cast<SparseIndex>(INVALID_INDEX));
+    }
+    _size = 0;
+
+    _componentArray.clear();
+    _indexToEntity.clear();
+    if (count > _componentArray.capacity())
+    {
+      Reserve(count);
+    }
+    _componentArray.resize(count);
+    _indexToEntity.resize(count);
+
+    if (!reader.ReadBytes(_indexToEntity.data(), count * sizeof(Entity)) ||
+        !ComponentSerializer<T>::Read(reader, std::span<T>(_componentArray.data(), count)))
+    {
+      _componentArray.clear();
+      _indexToEntity.clear();
+      return false;
+    }
+
+    // Rebuild the entity → index lookup from the packed entity list
+    for (size_t i = 0; i < count; ++i)
+    {
+      Entity entity = _indexToEntity[i];
+      if (entity >= MAX_ENTITIES)
+        return false;
+      SparseSlot(entity) = static_cast<SparseIndex>(i);
+    }
+    _size = count;
+    return true;
+  }
 }
@@ -4,7 +4,10 @@
 #include <unordered_map>
 #include <typeindex>
 #include <cassert>
+#include <string>
+#include <vector>
 #include "ComponentArray.h"
+#include "Telemetry.h"
 #include "Types.h"
 
 
@@ -40,8 +43,20 @@ namespace Engine
     template <typename T>
     T &GetComponent(Entity entity) const;
 
+    template <typename T>
+    IComponentArray *GetComponentStorage();     // T's array behind the type-erased interface (registers T if needed)
+
+    template <typename T>
+    ComponentArray<T> &GetPackedArray();        // T's array itself, for linear scans over packed data (registers T if needed)
+
     void EntityDestroyed(Entity entity);
 
+    void CollectTelemetry(std::vector<Telemetry::ComponentStats> &components) const; // Size, capacity and memory of every array
+    void Shrink();                                                                   // Give back capacity every array no longer needs
+
+    void Serialize(SnapshotWriter &writer) const; // Write every registered component array, in component type order
+    bool Deserialize(SnapshotReader &reader);     // Requires the same components to be registered in the same order
+
   private:
     std::unordered_map<std::type_index, ComponentType> _componentTypes{};                      // Map: component type name → unique ID (0, 1, 2, ...)
                                                                                                // Why: We need a number to represent each component type for signatures (bitsets)
@@ -55,8 +70,11 @@ namespace Engine
     ComponentType _nextComponentType{};                                                        // Counter: The next component type ID to assign
                                                                                                // Starts at 0, increments each time we register a new component type
 
+    std::unordered_map<std::type_index, std::string> _componentNames{};                        // Map: component type → readable name (for telemetry)
+                                                                                               // Why a map? Its nodes never move, so telemetry can hand out string_views
+
     template <typename T>
-    std::shared_ptr<ComponentArray<T>> GetComponentArray() const;
+    ComponentArray<T> *GetComponentArray() const;
   };
 
   // =======================================================
@@ -72,6 +90,7 @@ namespace Engine
 
     _componentTypes.insert({typeIndex, _nextComponentType});                      // Give this component type a unique ID number
     _componentStorage.insert({typeIndex, std::make_shared<ComponentArray<T>>()}); // Create a new array to store all components of this type
+    _componentNames.insert({typeIndex, ReadableTypeName(typeid(T))});             // Name it once, so telemetry never allocates
 
     ++_nextComponentType;                                                         // Increment so the next component type gets a different ID
   }
@@ -109,12 +128,27 @@ namespace Engine
   }
 
   template <typename T>
-  std::shared_ptr<ComponentArray<T>> ComponentManager::GetComponentArray() const
+  IComponentArray *ComponentManager::GetComponentStorage()
+  {
+    GetComponentType<T>();
+    return GetComponentArray<T>();
+  }
+
+  template <typename T>
+  ComponentArray<T> &ComponentManager::GetPackedArray()
+  {
+    GetComponentType<T>();
+    return *GetComponentArray<T>();
+  }
+
+  template <typename T>
+  ComponentArray<T> *ComponentManager::GetComponentArray() const
   {
     std::type_index typeIndex = typeid(T);
     assert(_componentStorage.find(typeIndex) != _componentStorage.end() && "Component not registered before use.");
 
-    return std::static_pointer_cast<ComponentArray<T>>(_componentStorage.at(typeIndex)); // Cast the generic IComponentArray back to the specific ComponentArray<T> type
-                                                                                      // This is safe because we know we stored a ComponentArray<T> when we registered it
+    return static_cast<ComponentArray<T> *>(_componentStorage.at(typeIndex).get()); // Cast the generic IComponentArray back to the specific ComponentArray<T> type
+                                                                                    // This is safe because we know we stored a ComponentArray<T> when we registered it
+                                                                                    // Raw pointer on purpose: copying the shared_ptr would bump an atomic refcount on every Get
   }
 }
\ No newline at end of file
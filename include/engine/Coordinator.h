@@ -2,28 +2,80 @@
 
 #include <memory>
 #include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <vector>
 #include "Types.h"
+#include "FrameArena.h"
+#include "EventBus.h"
+#include "EntitySet.h"
+#include "SpawnTemplate.h"
+#include "Group.h"
+#include "Telemetry.h"
 #include "ComponentManager.h"
 #include "EntityManager.h"
 #include "SystemManager.h"
+#include "Relationships.h"
 
 /* What it does:
  * - Manages the creation, destruction, and component signatures of entities
  * - Manages the registration, addition, and removal of components
  * - Manages the registration, addition, and removal of systems
  * - Manages the matching of entities to systems based on component signatures
+ * - Manages parent → child relationships between entities (destroying a parent destroys its children)
+ * - Keeps owning groups sorted, so systems can scan component pairs linearly (GetGroup)
+ * - Carries typed events between systems, readable the frame after they're emitted (GetEvents)
+ *
+ * A Coordinator is one self-contained world: entities, components, systems, events and scratch memory.
+ * Create as many as you like (a game, a headless benchmark, an AI rollout) and hand them to systems
+ * by reference. Different worlds share no mutable state, so each can run on its own thread;
+ * a single world is still only safe to use from one thread at a time.
+ *
+ * The one exception is ReserveEntity(): parallel systems can call it together to claim IDs with no
+ * lock, then build those entities (Instantiate(entity, template), AddComponent...) back on one thread
+ * at the next sync point. A reserved ID counts as alive; destroy it if it ends up unused.
  */
 namespace Engine
 {
   class Coordinator
   {
   public:
-    static Coordinator &GetInstance();                          // Get the singleton instance
+    Coordinator();
+
+    Coordinator(const Coordinator &) = delete;
+    Coordinator &operator=(const Coordinator &) = delete;
 
     Entity CreateEntity();                                      // Create a new entity
-    void DestroyEntity(Entity entity);                          // Destroy an entity
+    Entity ReserveEntity();                                     // Thread-safe: claim an ID to build later (NULL_ENTITY if the pool is full)
+    void DestroyEntity(Entity entity);                          // Destroy an entity and all of its children
+    void DestroyDeferred(Entity entity);                        // Queue a destroy for FlushDestroyed() (safe while iterating, or twice)
+    void FlushDestroyed();                                      // Destroy everything queued (Game::Update calls it once per tick)
     std::size_t GetEntityCount() const;                         // Get the number of entities
 
+    void SetParent(Entity child, Entity parent);                // Attach child to parent (moves it if it had another parent)
+    void RemoveParent(Entity child);                            // Detach child from its parent, if any
+    Entity GetParent(Entity child) const;                       // NULL_ENTITY if the entity has no parent
+    template <typename Fn>
+    void ForEachChild(Entity parent, Fn &&fn) const;            // fn(child) for every direct child
+    template <typename Fn>
+    void ForEachChildGroup(const EntitySet &children, Fn &&fn); // fn(parent, span of children) once per parent of the set's entities
+
+    FrameArena &GetFrameArena();                                // Scratch memory that is wiped at the end of each frame
+    EventBus &GetEvents();                                      // Messages between systems (swapped at the end of each frame)
+    void CollectTelemetry(Telemetry &telemetry);                // Counts and array sizes; per-frame counters cover the time since the last call
+    void Shrink();                                              // Release component storage left over from a spawn spike (allocates: call it off the hot path)
+
+    std::vector<std::byte> SaveSnapshot() const;                // Serialize every entity, signature and component into a blob
+    bool LoadSnapshot(std::span<const std::byte> snapshot);     // Replace the world with a blob from SaveSnapshot() (same build only)
+
+    template <typename T>
+      requires std::is_class_v<T>
+    void RegisterComponent();                                   // Register a component up front so its type ID is deterministic
+
     template <typename T>
       requires std::is_class_v<T>
     void AddComponent(Entity entity, const T &component);       // Add a component to an entity
@@ -36,18 +88,50 @@ namespace Engine
     template <typename T>
       requires std::is_class_v<T>
     T *GetOptional(Entity entity);                              // Safe to request a component that may not exist
+    template <typename T>
+      requires std::is_class_v<T>
+    ComponentArray<T> &GetPackedArray();                        // Every T, packed: for bulk passes (indices change as components come and go)
+
+    template <typename T>
+      requires std::is_trivially_copyable_v<T>
+    void SetTemplateComponent(SpawnTemplate &spawnTemplate, const T &component); // Add (or overwrite) a component in a spawn template
+    template <typename T>
+      requires std::is_trivially_copyable_v<T>
+    std::optional<T> GetTemplateComponent(const SpawnTemplate &spawnTemplate);   // A template's copy of a component, if it has one
+    Entity Instantiate(const SpawnTemplate &spawnTemplate);     // Create an entity with all of a template's components at once
+    void Instantiate(Entity entity, const SpawnTemplate &spawnTemplate); // Same, into a reserved (still empty) entity
 
     template <typename T, typename... Components>
     std::shared_ptr<T> RegisterSystem();                        // Register a system
-  private:
-    Coordinator();
 
+    template <typename... Owned>
+    void RegisterGroup();                                       // Keep these components' arrays co-sorted (see Group)
+    template <typename... Owned>
+    GroupView<Owned...> GetGroup();                             // Entities with all of them: index i is the same entity in every span
+  private:
     template <typename T>
     ComponentType GetComponentType();                     // Get the component type for a given component (helper)
 
+    void AddGroup(Group group);                                 // Check nesting, insert outer groups first, then re-sort
+    const Group &FindGroup(const Signature &signature) const;
+    void EnterGroups(Entity entity, const Signature &signature); // After the entity gained components
+    void LeaveGroups(Entity entity, const Signature &signature); // Before the entity loses components (signature = what it keeps)
+    void RebuildGroups();
+
     std::unique_ptr<ComponentManager> _componentManager;        // Manages all component storage and retrieval
     std::unique_ptr<EntityManager> _entityManager;              // Manages entity creation, destruction, and signatures
     std::unique_ptr<SystemManager> _systemManager;              // Manages systems and entity-to-system matching
+    std::unique_ptr<Relationships> _relationships;              // Parent → children links between entities
+    std::unique_ptr<FrameArena> _frameArena;                    // Per-frame scratch allocator shared by all systems
+    std::unique_ptr<EventBus> _events;                          // Per-frame event queues shared by all systems
+    std::unique_ptr<EntitySet> _pendingDestroy;                 // Queued by DestroyDeferred(); a set, so nothing is destroyed twice
+    std::vector<Group> _groups;                                 // Owning groups, outer (fewer components) before inner
+
+    // Telemetry: running total of signature changes, and every running total as of the last CollectTelemetry()
+    std::uint64_t _signatureChanges{};
+    std::uint64_t _collectedCreated{};
+    std::uint64_t _collectedDestroyed{};
+    std::uint64_t _collectedSignatureChanges{};
   };
 
   // =======================================================
@@ -66,19 +150,30 @@ namespace Engine
     _entityManager->SetSignature(entity, signature);           // Update the entity's signature
 
     _systemManager->EntitySignatureChanged(entity, signature); // Notify all systems that the entity signature has changed
+    EnterGroups(entity, signature);                            // Move it into any group it now completes
+    ++_signatureChanges;
   }
 
   template <typename T>
     requires std::is_class_v<T>
   void Coordinator::RemoveComponent(Entity entity)
   {
-    _componentManager->RemoveComponent<T>(entity);             // Remove component from its component array
-
     auto signature = _entityManager->GetSignature(entity);     // Get current entity signature
     signature.reset(_componentManager->GetComponentType<T>()); // Turn off the bit for this component type
+    LeaveGroups(entity, signature);                            // Out of the sorted range before swap-and-pop moves things
+
+    _componentManager->RemoveComponent<T>(entity);             // Remove component from its component array
     _entityManager->SetSignature(entity, signature);           // Update the entity's signature
 
     _systemManager->EntitySignatureChanged(entity, signature); // Notify all systems that the entity signature has changed
+    ++_signatureChanges;
+  }
+
+  template <typename T>
+    requires std::is_class_v<T>
+  void Coordinator::RegisterComponent()
+  {
+    _componentManager->RegisterComponent<T>();
   }
 
   template <typename T>
@@ -88,6 +183,72 @@ namespace Engine
     return _componentManager->GetComponent<T>(entity);
   }
   
+  template <typename Fn>
+  void Coordinator::ForEachChild(Entity parent, Fn &&fn) const
+  {
+    for (Entity child = _relationships->GetFirstChild(parent); child != NULL_ENTITY;)
+    {
+      Entity next = _relationships->GetNextSibling(child); // Read first, so fn may detach or destroy the child
+      fn(child);
+      child = next;
+    }
+  }
+
+  /*
+   * Lets a system fetch shared parent data once per parent instead of once per child:
+   * for a set of weapons, fn(ship, weapons) runs once per ship with all of that ship's weapons in the set.
+   * Entities without a parent are skipped. The span lives in the frame arena and is only valid inside fn.
+   */
+  template <typename Fn>
+  void Coordinator::ForEachChildGroup(const EntitySet &children, Fn &&fn)
+  {
+    std::pmr::vector<Entity> group(&GetFrameArena());
+
+    for (Entity child : children)
+    {
+      Entity parent = _relationships->GetParent(child);
+      if (parent == NULL_ENTITY)
+        continue;
+
+      // Visit each parent once: when we reach the first of its children (in link order) that is in the set
+      Entity first = _relationships->GetFirstChild(parent);
+      while (!children.contains(first))
+      {
+        first = _relationships->GetNextSibling(first);
+      }
+      if (first != child)
+        continue;
+
+      group.clear();
+      for (Entity sibling = first; sibling != NULL_ENTITY; sibling = _relationships->GetNextSibling(sibling))
+      {
+        if (children.contains(sibling))
+          group.push_back(sibling);
+      }
+      fn(parent, std::span<const Entity>(group));
+    }
+  }
+
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  void Coordinator::SetTemplateComponent(SpawnTemplate &spawnTemplate, const T &component)
+  {
+    spawnTemplate.Set(GetComponentType<T>(), _componentManager->GetComponentStorage<T>(), &component, sizeof(T), alignof(T));
+  }
+
+  template <typename T>
+    requires std::is_trivially_copyable_v<T>
+  std::optional<T> Coordinator::GetTemplateComponent(const SpawnTemplate &spawnTemplate)
+  {
+    const std::byte *bytes = spawnTemplate.Find(GetComponentType<T>());
+    if (!bytes)
+      return std::nullopt;
+
+    T component{};
+    std::memcpy(&component, bytes, sizeof(T));
+    return component;
+  }
+
   template <typename T, typename... Components>
   std::shared_ptr<T> Coordinator::RegisterSystem()
   {
@@ -107,6 +268,27 @@ namespace Engine
     return system;
   }
 
+  template <typename... Owned>
+  void Coordinator::RegisterGroup()
+  {
+    static_assert(sizeof...(Owned) > 1, "A group needs at least two components");
+    static_assert((std::is_class_v<Owned> && ...), "All components must be structs/classes");
+
+    Signature signature;
+    (signature.set(GetComponentType<Owned>()), ...);
+
+    AddGroup(Group(signature, {_componentManager->GetComponentStorage<Owned>()...}));
+  }
+
+  template <typename... Owned>
+  GroupView<Owned...> Coordinator::GetGroup()
+  {
+    Signature signature;
+    (signature.set(GetComponentType<Owned>()), ...);
+
+    return GroupView<Owned...>(FindGroup(signature).size(), _componentManager->GetPackedArray<Owned>()...);
+  }
+
   template <typename Component>
     requires std::is_class_v<Component>
   Component *Coordinator::GetOptional(Entity entity)
@@ -119,6 +301,13 @@ namespace Engine
     return nullptr;
   }
 
+  template <typename T>
+  requires std::is_class_v<T>
+  ComponentArray<T> &Coordinator::GetPackedArray()
+  {
+    return _componentManager->GetPackedArray<T>();
+  }
+
   template <typename T>
   ComponentType Coordinator::GetComponentType()
   {
@@ -1,10 +1,11 @@
 #pragma once
 
 #include <array>
-#include <queue>
-#include <set>
+#include <atomic>
+#include <cstdint>
 
 #include "Types.h"
+#include "Snapshot.h"
 
 // =======================================================
 // EntityManager: Handles entity lifecycle and signatures
@@ -15,6 +16,7 @@
  * - Destroys entities and recycles their IDs for future use
  * - Tracks which components each entity has via signatures
  * - Provides signature lookup for systems to query entity composition
+ * - Lets several threads reserve IDs at once without a lock (ReserveEntity)
  *
  * What it does NOT do:
  * - Store actual component data (ComponentManager does this)
@@ -29,18 +31,36 @@ namespace Engine
   public:
     EntityManager();
     Entity CreateEntity();
+    Entity ReserveEntity();             // Thread-safe (wait-free): next free ID, or NULL_ENTITY if the pool is empty
     void DestroyEntity(Entity entity);
     void SetSignature(Entity entity, const Signature &signature);
     const Signature &GetSignature(Entity entity) const;
 
     size_t GetLivingEntityCount() const;
+    std::uint64_t GetCreatedCount() const;                              // Entities created (or reserved) since startup
+    std::uint64_t GetDestroyedCount() const { return _destroyedCount; } // Entities destroyed since startup
+
+    void Serialize(SnapshotWriter &writer) const; // Write the ID pool and every signature
+    bool Deserialize(SnapshotReader &reader);     // Restore the ID pool and every signature
   private:
-    std::queue<Entity> _entityIDs{};                    // Available entity IDs
+    void CommitReservations();                          // Fold reserved IDs into the counters below (single thread only)
+
+    std::array<Entity, MAX_ENTITIES> _entityIDs{};      // Available entity IDs, used as a fixed-size ring buffer (FIFO queue)
                                                         // When we destroy an entity, its ID goes back in the queue for reuse
+                                                        // Why not std::queue? Its deque allocates new blocks as IDs cycle through it
+    size_t _freeHead{};                                 // Ring buffer index of the next ID to hand out
+    size_t _freeCount{};                                // Number of IDs currently in the ring buffer
+    std::atomic<size_t> _reserved{};                    // IDs handed out from the front of the ring since the last commit
+                                                        // Why: reserving is one fetch_add on this counter, so parallel systems
+                                                        // can claim IDs without a mutex. Nothing else in the ring changes until
+                                                        // the next single-threaded call (DestroyEntity, Serialize...) commits them.
 
     std::array<Signature, MAX_ENTITIES> _signatures{};  // Signatures for each entity
                                                         // Index by entity ID to get its signature
 
     size_t _livingEntityCount{};                        // Total living entities - keep track for debugging and validation
+
+    std::uint64_t _createdCount{};                      // Running totals for telemetry (not part of snapshots)
+    std::uint64_t _destroyedCount{};
   };
 }
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+#include "Types.h"
+
+namespace Engine
+{
+  /*
+   * EntitySet: a fixed-capacity sparse set of entities
+   *
+   * Why not std::set? Every insert into a std::set allocates a tree node, and iterating it chases
+   * pointers all over the heap. Systems gain and lose entities every time a projectile spawns or dies,
+   * so that was a heap allocation per spawn per system.
+   *
+   * How it works:
+   * - _dense holds the entities packed together, so iteration is a linear scan
+   * - _sparse maps entity ID → position in _dense, so insert/erase/contains are O(1)
+   * - erase uses swap-and-pop, so iteration order is NOT sorted (don't rely on it)
+   */
+  class EntitySet
+  {
+  public:
+    using const_iterator = const Entity *;
+
+    EntitySet() { _sparse.fill(INVALID_INDEX); }
+
+    // Add an entity (does nothing if it is already in the set)
+    void insert(Entity entity)
+    {
+      assert(entity < MAX_ENTITIES && "Entity is out of range.");
+      if (contains(entity))
+        return;
+
+      _sparse[entity] = _size;
+      _dense[_size] = entity;
+      ++_size;
+    }
+
+    // Remove an entity (does nothing if it is not in the set)
+    void erase(Entity entity)
+    {
+      assert(entity < MAX_ENTITIES && "Entity is out of range.");
+      if (!contains(entity))
+        return;
+
+      size_t removeIndex = _sparse[entity];
+      Entity lastEntity = _dense[_size - 1];
+
+      _dense[removeIndex] = lastEntity;    // Move the last entity into the gap
+      _sparse[lastEntity] = removeIndex;
+      _sparse[entity] = INVALID_INDEX;
+      --_size;
+    }
+
+    // Remove every entity
+    void clear()
+    {
+      for (size_t i = 0; i < _size; ++i)
+      {
+        _sparse[_dense[i]] = INVALID_INDEX;
+      }
+      _size = 0;
+    }
+
+    bool contains(Entity entity) const { return _sparse[entity] != INVALID_INDEX; }
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    const_iterator begin() const { return _dense.data(); }
+    const_iterator end() const { return _dense.data() + _size; }
+
+  private:
+    static constexpr size_t INVALID_INDEX = MAX_ENTITIES;
+
+    std::array<Entity, MAX_ENTITIES> _dense{};  // Packed list of entities in the set
+    std::array<size_t, MAX_ENTITIES> _sparse{}; // Entity ID → index into _dense (INVALID_INDEX if missing)
+    size_t _size{};                             // Number of valid entries in _dense
+  };
+}
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+#include "Telemetry.h"
+
+namespace Engine
+{
+  // IEventQueue lets the bus flip every queue at the end of a frame without knowing their event types.
+  class IEventQueue
+  {
+  public:
+    virtual ~IEventQueue() = default;
+    virtual void Swap() = 0;                   // This frame's events become readable, last frame's are dropped
+    virtual void Clear() = 0;                  // Drop both frames' events
+    virtual std::size_t ReadableCount() const = 0;
+  };
+
+  /**
+   * EventQueue<T> - Every T emitted in one frame, in one contiguous array
+   *
+   * Two buffers: systems append to the write buffer during a frame, and read the other one, which holds
+   * everything emitted during the previous frame. Swap() flips them and clears the new write buffer.
+   * Both keep their capacity, so once a frame's peak has been seen, emitting never allocates.
+   */
+  template <typename T>
+  class EventQueue : public IEventQueue
+  {
+  public:
+    void Emit(const T &event) { _writing.push_back(event); }
+    void Emit(std::span<const T> events) { _writing.insert(_writing.end(), events.begin(), events.end()); }
+
+    std::span<const T> Read() const { return _readable; } // Last frame's events, in the order they were emitted
+
+    void Swap() override
+    {
+      _readable.swap(_writing);
+      _writing.clear();
+    }
+
+    void Clear() override
+    {
+      _readable.clear();
+      _writing.clear();
+    }
+
+    std::size_t ReadableCount() const override { return _readable.size(); }
+
+  private:
+    std::vector<T> _writing;  // Emitted this frame
+    std::vector<T> _readable; // Emitted last frame
+  };
+
+  /**
+   * EventBus - Typed, double-buffered messages between systems
+   *
+   * Why: Systems that need to tell each other something (a hit, a death, a shot fired) used to either
+   * call each other directly or print to std::cerr. With the bus, one system emits a plain struct and
+   * any other reads all of them at once on the next frame, without either knowing about the other:
+   *
+   *   events.Emit(Events::ShotFired{...});
+   *   for (const auto &shot : events.Read<Events::ShotFired>()) { ... }
+   *
+   * Events are double-buffered per frame: whatever is emitted during frame N is readable during frame N+1,
+   * whichever order the systems run in. Game::Update calls Swap() at the end of every tick.
+   *
+   * Emit<T>() and Read<T>() look the queue up by type each call. A loop that emits thousands of events
+   * should fetch GetQueue<T>() once, or build them in a span and emit them together.
+   *
+   * Events are plain data like components. Not thread-safe: only the simulation thread may use it.
+   * They aren't part of snapshots: LoadSnapshot() clears them.
+   */
+  class EventBus
+  {
+  public:
+    template <typename T>
+    void RegisterEvent();                   // Register an event type up front (optional; first use registers it too)
+
+    template <typename T>
+    EventQueue<T> &GetQueue();              // T's queue itself, for emitting or reading many events
+
+    template <typename T>
+    void Emit(const T &event);              // Readable next frame
+
+    template <typename T>
+    void Emit(std::span<const T> events);   // Same, for a whole batch
+
+    template <typename T>
+    std::span<const T> Read();              // Everything emitted last frame
+
+    void Swap();                            // End of frame: publish this frame's events, drop last frame's
+    void Clear();                           // Drop every pending event (e.g. after loading a snapshot)
+
+    void CollectTelemetry(std::vector<Telemetry::EventStats> &events) const; // Events readable this frame, per type
+
+  private:
+    std::unordered_map<std::type_index, std::size_t> _eventTypes{}; // Map: event type → index in _queues
+    std::vector<std::unique_ptr<IEventQueue>> _queues{};             // In registration order, so swaps and telemetry are deterministic
+    std::deque<std::string> _names{};                                // Readable name per queue (a deque never moves them, so telemetry can hand out string_views)
+  };
+
+  // =======================================================
+
+  template <typename T>
+  void EventBus::RegisterEvent()
+  {
+    static_assert(std::is_trivially_copyable_v<T>, "Events are plain data");
+
+    std::type_index typeIndex = typeid(T);
+    if (_eventTypes.find(typeIndex) != _eventTypes.end())
+    {
+      return;
+    }
+
+    _eventTypes.insert({typeIndex, _queues.size()});
+    _queues.push_back(std::make_unique<EventQueue<T>>());
+    _names.push_back(ReadableTypeName(typeid(T)));
+  }
+
+  template <typename T>
+  EventQueue<T> &EventBus::GetQueue()
+  {
+    auto found = _eventTypes.find(typeid(T));
+    if (found == _eventTypes.end())
+    {
+      RegisterEvent<T>();
+      found = _eventTypes.find(typeid(T));
+    }
+
+    return *static_cast<EventQueue<T> *>(_queues[found->second].get()); // Safe: index was assigned when EventQueue<T> was created
+  }
+
+  template <typename T>
+  void EventBus::Emit(const T &event)
+  {
+    GetQueue<T>().Emit(event);
+  }
+
+  template <typename T>
+  void EventBus::Emit(std::span<const T> events)
+  {
+    GetQueue<T>().Emit(events);
+  }
+
+  template <typename T>
+  std::span<const T> EventBus::Read()
+  {
+    return GetQueue<T>().Read();
+  }
+}
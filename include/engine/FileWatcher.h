@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace Engine
+{
+  /**
+   * FileWatcher - Calls back when a watched file is written, from a background thread
+   *
+   * Why: Hot reload needs to know when an asset changes on disk. Polling with stat() every frame
+   * would put filesystem calls on the render path. Instead a background thread blocks on the OS
+   * change notifications (inotify on Linux) and only wakes up when something was actually written.
+   *
+   * - Watch() the files you care about, then Start(onChanged)
+   * - onChanged(path) runs on the watcher thread: do slow work there (e.g. decode the file), and
+   *   hand the result to the main thread yourself
+   * - Directories are watched rather than files, so editors that save by writing a temp file and
+   *   renaming it over the original are still caught
+   *
+   * On platforms without inotify, Start() prints a note and does nothing (assets just don't reload).
+   */
+  class FileWatcher
+  {
+  public:
+    using Callback = std::function<void(const std::string &path)>;
+
+    FileWatcher() = default;
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher &) = delete;
+    FileWatcher &operator=(const FileWatcher &) = delete;
+
+    void Watch(const std::string &path); // Call before Start()
+    bool Start(Callback onChanged);
+    void Stop();
+
+  private:
+    void Run();
+
+    std::unordered_set<std::string> _files;                 // Watched paths (normalized)
+    std::unordered_map<int, std::string> _directoryByWatch; // inotify watch descriptor -> directory
+    Callback _onChanged;
+    std::thread _thread;
+    std::atomic<bool> _stopping{false};
+    int _inotify = -1;
+  };
+}
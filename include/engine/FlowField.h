@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Vec2.h"
+
+namespace Engine
+{
+  /**
+   * FlowField - One shared path toward a goal that any number of agents can follow
+   *
+   * Why: Thousands of enemies each running their own A* would never scale. Instead we run a single
+   * Dijkstra from the goal (the player) over a grid, and store in every cell which way to go next.
+   * An agent then just looks up the cell it's standing in: O(1) per agent, no matter how many there are.
+   *
+   * How it works:
+   * - Cost field: every cell has a cost to walk through (1 by default, BLOCKED for walls)
+   * - Integration field: Dijkstra distance from every cell to the goal cell
+   * - Direction field: each cell points at its cheapest neighbour (8 directions)
+   *
+   * Incremental + time-sliced:
+   * - SetGoal() only starts a rebuild when the goal moves into a different cell
+   * - Step(budget) expands at most `budget` cells per call, so a rebuild is spread over several frames
+   * - Agents keep sampling the previous (complete) direction field until the new one is finished,
+   *   then the two are swapped. A rebuild can never spike frame time.
+   *
+   * Not thread-safe: call everything from the simulation thread.
+   */
+  class FlowField
+  {
+  public:
+    static constexpr std::uint8_t BLOCKED = 255; // Cost for cells nothing can walk through
+
+    FlowField(Vec2 origin, float cellSize, std::int32_t columns, std::int32_t rows);
+
+    void SetCost(std::int32_t column, std::int32_t row, std::uint8_t cost); // Change a cell's walking cost (triggers a rebuild)
+    void SetGoal(const Vec2 &worldPosition);                                 // Start a rebuild if the goal changed cell
+    void Step(std::size_t cellBudget);                                       // Do up to cellBudget cells of rebuild work
+
+    // Direction to walk from a world position (unit vector), or {0, 0} at the goal, outside the grid,
+    // in unreachable cells, or before the first build has finished
+    Vec2 Sample(const Vec2 &worldPosition) const;
+
+    bool IsRebuilding() const;
+
+  private:
+    static constexpr std::uint32_t UNREACHED = UINT32_MAX;
+
+    // QueueEntry is a cell waiting to be expanded, ordered by its distance to the goal.
+    struct QueueEntry
+    {
+      std::uint32_t distance;
+      std::uint32_t cell;
+    };
+
+    std::int32_t CellIndex(const Vec2 &worldPosition) const; // -1 if outside the grid
+    void StartRebuild();
+    void BuildDirections();
+
+    Vec2 _origin;                            // World position of the top-left corner of cell (0, 0)
+    float _cellSize;
+    float _inverseCellSize;
+    std::int32_t _columns;
+    std::int32_t _rows;
+
+    std::vector<std::uint8_t> _costs;        // Cost field
+    std::vector<std::uint32_t> _distances;   // Integration field being built (Dijkstra distances)
+    std::vector<QueueEntry> _queue;          // Dijkstra min-heap (kept between rebuilds so it doesn't reallocate)
+    std::vector<Vec2> _directions;           // Direction field agents read from (the finished one)
+    std::vector<Vec2> _pendingDirections;    // Direction field written when a rebuild completes, then swapped in
+
+    std::int32_t _goalCell{-1};              // Cell the current/last rebuild targets
+    bool _rebuilding{false};                 // A Dijkstra run is in progress
+    bool _dirty{false};                      // Costs or goal changed while rebuilding, start over when done
+  };
+}
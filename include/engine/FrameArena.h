@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+namespace Engine
+{
+  /**
+   * FrameArena - A linear (bump) allocator for scratch memory that only lives for one frame
+   *
+   * Why: Systems keep needing temporary buffers (entities to destroy, collision pairs, render lists...).
+   * Allocating them with new/delete every frame is slow and fragments the heap. Instead we grab one
+   * big block up front, hand out slices of it by bumping an offset, and throw everything away at once
+   * when the frame ends by resetting the offset back to zero.
+   *
+   * It is a std::pmr::memory_resource, so any pmr container can use it:
+   *   std::pmr::vector<Entity> scratch(&coordinator.GetFrameArena());
+   *
+   * Rules:
+   * - Anything allocated from the arena is invalid after Reset() (Game::Update calls it at the end of every tick)
+   * - Deallocating is a no-op, memory only comes back on Reset()
+   * - Not thread-safe: only the simulation thread may use it
+   *
+   * If a frame needs more than the block holds, the extra requests fall back to the heap and are counted.
+   * On the next Reset() the block grows to fit that peak, so the heap fallback stops after warm-up.
+   */
+  class FrameArena : public std::pmr::memory_resource
+  {
+  public:
+    static constexpr std::size_t DEFAULT_CAPACITY = 256 * 1024; // 256 KB
+
+    explicit FrameArena(std::size_t capacity = DEFAULT_CAPACITY);
+
+    // Prevent copying
+    FrameArena(const FrameArena &) = delete;
+    FrameArena &operator=(const FrameArena &) = delete;
+
+    // Free everything allocated this frame (grows the block first if the frame spilled to the heap)
+    void Reset();
+
+    std::size_t GetUsedBytes() const;       // Bytes handed out since the last Reset()
+    std::size_t GetCapacity() const;        // Size of the current block
+    std::size_t GetPeakBytes() const;       // Largest single-frame usage seen so far (including spills)
+    std::size_t GetHeapAllocations() const; // Total number of requests that missed the block and hit the heap
+
+  private:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override;
+
+    std::unique_ptr<std::byte[]> _buffer;           // The block we bump through
+    std::size_t _capacity{};                        // Size of _buffer in bytes
+    std::size_t _offset{};                          // Next free byte in _buffer
+
+    std::pmr::monotonic_buffer_resource _overflow;  // Heap fallback for frames that outgrow the block
+    std::size_t _overflowBytes{};                   // Bytes served from _overflow this frame
+
+    std::size_t _peakBytes{};                       // High-water mark used to size the block
+    std::size_t _heapAllocations{};                 // Counts heap fallbacks so debug builds can prove steady state is allocation-free
+  };
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <vector>
+
+#include "Types.h"
+#include "ComponentArray.h"
+
+namespace Engine
+{
+  class EntityManager;
+
+  /**
+   * Group - An owning group: keeps several component arrays sorted so that their first size() slots
+   * belong to the same entities in the same order
+   *
+   * Why: A system reading Transform and Velocity looks each one up in its own packed array, and after a
+   * few swap-and-pop removals the two arrays are in unrelated orders, so every entity is two random
+   * reads. A group moves its members to the front of every array it owns, in lockstep, so index i is the
+   * same entity everywhere and a joint pass is a straight linear scan (see Coordinator::GetGroup()).
+   *
+   * How it stays sorted:
+   * - Enter() swaps a new member into slot size() of each owned array, Leave() swaps it out to the last
+   *   member slot, before the component is removed (swap-and-pop only ever touches non-members after that)
+   * - Two groups may own the same component only if one's components contain the other's (nesting, e.g.
+   *   Transform+Sprite and Transform+Sprite+Velocity): the inner group's members are then a prefix of
+   *   the outer group's, so both can be kept sorted in the same arrays
+   */
+  class Group
+  {
+  public:
+    Group(const Signature &signature, std::vector<IComponentArray *> owned);
+
+    const Signature &GetSignature() const { return _signature; }
+    std::size_t size() const { return _size; }
+    bool Contains(Entity entity) const { return _owned.front()->IndexOf(entity) < _size; }
+
+    void Enter(Entity entity);                        // Entity must already have every owned component
+    void Leave(Entity entity);                        // Call before any owned component is removed
+    void Rebuild(const EntityManager &entityManager); // Re-sort from scratch (no-op on arrays that are already grouped)
+
+  private:
+    Signature _signature;                  // Every owned component
+    std::vector<IComponentArray *> _owned; // The arrays this group keeps sorted
+    std::size_t _size{};                   // Members sit in slots [0, _size) of every owned array
+  };
+
+  // GroupView is a typed look at one group's members: index i is the same entity in every span.
+  template <typename... Owned>
+  class GroupView
+  {
+  public:
+    GroupView(std::size_t size, ComponentArray<Owned> &...arrays)
+        : _size(size), _arrays(&arrays...) {}
+
+    std::size_t size() const { return _size; }
+
+    // Members, in the order their components are stored
+    std::span<const Entity> GetEntities() const
+    {
+      return {std::get<0>(_arrays)->GetPackedEntities(), _size};
+    }
+
+    template <typename T>
+    std::span<T> Get() const
+    {
+      return {std::get<ComponentArray<T> *>(_arrays)->GetPackedData(), _size};
+    }
+
+  private:
+    std::size_t _size;
+    std::tuple<ComponentArray<Owned> *...> _arrays;
+  };
+}
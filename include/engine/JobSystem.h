@@ -0,0 +1,328 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "AllocationTracker.h"
+
+namespace Engine
+{
+  class JobCounter;
+  class JobSystem;
+
+  // Job is one unit of work: a plain function pointer and what it works on, so queuing one never allocates.
+  struct Job
+  {
+    void (*function)(void *data, std::size_t begin, std::size_t end) = nullptr;
+    void *data = nullptr;
+    std::size_t begin = 0;                  // Range handed to function (ParallelFor chunks), unused otherwise
+    std::size_t end = 0;
+    JobCounter *counter = nullptr;          // Decremented once function returns (may be null)
+    FramePhase phase = FramePhase::Startup; // Allocation phase of whoever scheduled it, so audits follow the work
+  };
+
+  /**
+   * JobCounter - How many jobs of one batch are still running, and who is waiting for them
+   *
+   * Every Run(), ParallelFor() chunk and Start() adds to a counter, and each finished job takes one
+   * off. Wait on it with JobSystem::Wait(counter) from plain code, or `co_await counter` from a JobTask.
+   *
+   * Lives wherever the caller likes (usually on the stack next to the work it tracks). Once Wait()
+   * returns, or a co_await on it resumes, it may be destroyed or reused for the next batch.
+   */
+  class JobCounter
+  {
+  public:
+    JobCounter() = default;
+
+    // Prevent copying (jobs point at it)
+    JobCounter(const JobCounter &) = delete;
+    JobCounter &operator=(const JobCounter &) = delete;
+
+    bool IsDone() const { return _pending.load(std::memory_order_acquire) == 0; } // A hint only: use Wait() before destroying it
+
+    auto operator co_await() noexcept; // Suspend the calling JobTask until every job has finished
+
+  private:
+    friend class JobSystem;
+
+    // A JobTask suspended on this counter. Lives in the coroutine frame, so waiting never allocates.
+    struct Continuation
+    {
+      std::coroutine_handle<> handle;
+      JobSystem *system = nullptr;
+      Continuation *next = nullptr;
+    };
+
+    void Add(std::size_t count);           // Taking it off zero starts a new batch
+    void Decrement();                      // The last one wakes blocked waiters and reschedules suspended tasks
+    void Block();                          // Sleep until the last Decrement() has finished with this counter
+    bool Suspend(Continuation &waiter);    // False if already finished (the task carries straight on)
+
+    std::atomic<std::size_t> _pending{0};
+    std::mutex _mutex;                     // Only taken when the count reaches zero, or to wait for that
+    std::condition_variable _finishedSignal;
+    bool _finished = true;                 // Guarded by _mutex: set by the last Decrement(), cleared by the next Add()
+    Continuation *_continuations = nullptr; // Guarded by _mutex
+  };
+
+  /**
+   * JobTask - A coroutine the JobSystem runs, which can co_await counters without blocking a thread
+   *
+   * Why: Frame work is a graph of stages, some of which wait for others. A plain job that waits ties up
+   * its thread; a JobTask suspends instead, and the thread goes back to running jobs until the
+   * dependency finishes, at which point the task is queued again (possibly on another thread):
+   *
+   *   Engine::JobTask Game::Update(float dt)
+   *   {
+   *     Engine::JobCounter particlesDone;
+   *     _jobs.Run(particlesDone, updateParticles);
+   *     ExtractSprites();
+   *     co_await particlesDone;
+   *     ExtractParticles();
+   *   }
+   *
+   *   jobs.Start(Update(dt), tickDone); // ...
+   *   jobs.Wait(tickDone);
+   *
+   * Tasks start suspended and only run once Start()ed. Their frames come from a pool inside the
+   * JobSystem, so a task per frame stops allocating after warm-up.
+   */
+  class JobTask
+  {
+  public:
+    struct promise_type
+    {
+      JobSystem *system = nullptr;   // Set by Start()
+      JobCounter *counter = nullptr; // Set by Start(), decremented once the task has returned and its frame is gone
+
+      // FinalAwaiter frees the finished task's frame, and only then counts it as done: whoever waits on
+      // the counter may destroy what the task's locals refer to as soon as it is.
+      struct FinalAwaiter
+      {
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<promise_type> handle) noexcept;
+        void await_resume() const noexcept {}
+      };
+
+      JobTask get_return_object() { return JobTask{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+      std::suspend_always initial_suspend() noexcept { return {}; }
+      FinalAwaiter final_suspend() noexcept { return {}; }
+      void return_void() {}
+      void unhandled_exception() noexcept { std::terminate(); }
+
+      static void *operator new(std::size_t size);
+      static void operator delete(void *pointer, std::size_t size);
+    };
+
+    JobTask(JobTask &&other) noexcept : _handle(std::exchange(other._handle, {})) {}
+    JobTask &operator=(JobTask &&other) noexcept;
+    ~JobTask();
+
+    // Prevent copying
+    JobTask(const JobTask &) = delete;
+    JobTask &operator=(const JobTask &) = delete;
+
+  private:
+    friend class JobSystem;
+    explicit JobTask(std::coroutine_handle<promise_type> handle) : _handle(handle) {}
+
+    std::coroutine_handle<promise_type> _handle; // Null once started (the running task owns its frame)
+  };
+
+  /**
+   * JobSystem - One pool of worker threads that every part of the frame shares
+   *
+   * Why: The simulation thread, asset decoding and parallel loops inside systems each used to need
+   * their own thread. With one pool sized to the machine, they all become jobs, and a thread that has
+   * nothing to do takes work from whichever part of the frame has some.
+   *
+   * - Each thread has its own work-stealing deque (Chase-Lev: lock-free, the owner pushes and pops
+   *   at the bottom, idle threads steal from the top), so scheduling touches no shared lock
+   * - The thread that creates the JobSystem takes part too: it runs jobs while it sits in Wait()
+   * - Other threads (e.g. a file watcher) can schedule jobs as well, through a small locked queue
+   * - Jobs run under the allocation phase of whoever scheduled them (see AllocationTracker.h)
+   *
+   * Usage:
+   *   Engine::JobCounter done;
+   *   auto moveChunk = [&](std::size_t begin, std::size_t end) { ... };
+   *   jobs.ParallelFor(done, count, 1024, moveChunk); // returns immediately
+   *   jobs.Wait(done);                                 // runs jobs itself until the batch is finished
+   *
+   * Functions are taken by reference, not copied: keep them alive until the counter is done.
+   * Finish every batch before destroying the JobSystem.
+   */
+  class JobSystem
+  {
+  public:
+    explicit JobSystem(std::size_t workerCount = DefaultWorkerCount());
+    ~JobSystem();
+
+    // Prevent copying
+    JobSystem(const JobSystem &) = delete;
+    JobSystem &operator=(const JobSystem &) = delete;
+
+    // One less than the hardware threads (the creating thread is the other one), and at least one
+    static std::size_t DefaultWorkerCount();
+
+    // Threads that run jobs: the workers plus the creating thread
+    std::size_t GetThreadCount() const { return _workers.size(); }
+
+    // Schedule one job, function(data, begin, end), counting it on job.counter (the low-level form the others are built on)
+    void Schedule(Job job);
+
+    // Schedule function() as one job
+    template <typename Function>
+    void Run(JobCounter &counter, Function &function);
+
+    // Split [0, count) into chunks of at least minChunkSize and schedule function(begin, end) for each.
+    // A loop that fits in one chunk runs right here instead.
+    template <typename Function>
+    void ParallelFor(JobCounter &counter, std::size_t count, std::size_t minChunkSize, Function &function);
+
+    // Schedule a task. It counts as one job on counter until it returns.
+    void Start(JobTask task, JobCounter &counter);
+
+    // Run jobs on this thread until every job on counter has finished (sleeps if there is nothing to help with)
+    void Wait(JobCounter &counter);
+
+  private:
+    // Capacity of each thread's deque and job ring: more jobs in flight from one thread than this run inline
+    static constexpr std::size_t MAX_JOBS_PER_THREAD = 4096;
+
+    // WorkStealingQueue is a fixed-size Chase-Lev deque of job pointers.
+    class WorkStealingQueue
+    {
+    public:
+      bool IsFull() const;  // Owner only (thieves only ever make room, so a "full" answer can't be wrong for long)
+      void Push(Job *job);  // Owner only, and only when not full
+      bool Pop(Job &job);   // Owner only. Newest first, so the owner keeps working on warm data
+      bool Steal(Job &job); // Any thread. Oldest first. False when empty, or when another thread got there first
+
+    private:
+      std::array<std::atomic<Job *>, MAX_JOBS_PER_THREAD> _slots{};
+      alignas(64) std::atomic<std::int64_t> _top{0};    // Next slot to steal (only thieves and the last Pop move it)
+      alignas(64) std::atomic<std::int64_t> _bottom{0}; // Next slot to push (owner only)
+    };
+
+    // Worker is one thread's share of the pool: its deque, and the ring its queued jobs live in.
+    // The ring is twice the deque, so a slot is rewritten a whole deque's worth of pushes after its
+    // job left the deque; whoever took it copied it out before claiming it.
+    struct Worker
+    {
+      WorkStealingQueue queue;
+      std::array<Job, MAX_JOBS_PER_THREAD * 2> jobs{};
+      std::size_t nextJob = 0;
+      std::uint32_t randomState = 0;               // Picks the first victim to steal from
+      std::thread thread;                          // Not started for the creating thread (index 0)
+    };
+
+    // Coroutine plumbing for JobTask and JobCounter
+    static void ResumeTask(void *address, std::size_t, std::size_t);
+    static void FinishTask(JobCounter &counter) { counter.Decrement(); }
+    static void *AllocateTaskFrame(std::size_t size);
+    static void FreeTaskFrame(void *pointer, std::size_t size);
+    void Resume(std::coroutine_handle<> handle); // Queue a suspended task to carry on
+
+    void Push(const Job &job);          // Queue a job whose counter has already been added to
+
+    Worker *GetCurrentWorker() const;   // The calling thread's Worker, or null if it isn't part of this pool
+    bool FindJob(Worker *self, Job &job);
+    void Execute(const Job &job);
+    void WorkerLoop(std::size_t index);
+    void WakeOne();
+
+    std::vector<std::unique_ptr<Worker>> _workers; // [0] is the creating thread
+
+    std::mutex _externalMutex;                // Jobs scheduled from threads outside the pool
+    std::vector<Job> _externalJobs;           // Guarded by _externalMutex
+    std::atomic<bool> _hasExternalJobs{false};
+
+    std::atomic<std::uint32_t> _wakeEpoch{0}; // Bumped on every Schedule(); idle workers sleep on it
+    std::atomic<std::size_t> _sleepers{0};    // Workers asleep (or about to be), so Schedule() can skip notify
+    std::atomic<bool> _stopping{false};
+
+    friend class JobCounter;
+    friend struct JobTask::promise_type;
+    friend struct JobTask::promise_type::FinalAwaiter;
+  };
+
+  // =======================================================
+
+  inline auto JobCounter::operator co_await() noexcept
+  {
+    struct Awaiter
+    {
+      JobCounter &counter;
+      Continuation waiter{};
+
+      // Always goes through Suspend(): IsDone() can be true a moment before the last job has let go of the counter
+      bool await_ready() const noexcept { return false; }
+
+      bool await_suspend(std::coroutine_handle<JobTask::promise_type> handle)
+      {
+        waiter.handle = handle;
+        waiter.system = handle.promise().system;
+        return counter.Suspend(waiter);
+      }
+
+      void await_resume() const noexcept {}
+    };
+
+    return Awaiter{*this};
+  }
+
+  template <typename Function>
+  void JobSystem::Run(JobCounter &counter, Function &function)
+  {
+    Schedule({.function = [](void *data, std::size_t, std::size_t)
+              { (*static_cast<Function *>(data))(); },
+              .data = &function,
+              .counter = &counter,
+              .phase = AllocationTracker::GetPhase()});
+  }
+
+  template <typename Function>
+  void JobSystem::ParallelFor(JobCounter &counter, std::size_t count, std::size_t minChunkSize, Function &function)
+  {
+    if (count == 0)
+      return;
+
+    // A few chunks per thread, so a thread that finishes early can steal the rest
+    std::size_t maxChunks = GetThreadCount() * 4;
+    std::size_t chunks = std::max<std::size_t>(1, std::min(count / std::max<std::size_t>(minChunkSize, 1), maxChunks));
+    if (chunks == 1)
+    {
+      function(std::size_t{0}, count);
+      return;
+    }
+
+    counter.Add(chunks);
+    Job job{.function = [](void *data, std::size_t begin, std::size_t end)
+            { (*static_cast<Function *>(data))(begin, end); },
+            .data = &function,
+            .counter = &counter,
+            .phase = AllocationTracker::GetPhase()};
+
+    // Spread the remainder over the first chunks so no chunk is more than one element bigger than another
+    std::size_t begin = 0;
+    for (std::size_t chunk = 0; chunk < chunks; ++chunk)
+    {
+      std::size_t size = count / chunks + (chunk < count % chunks ? 1 : 0);
+      job.begin = begin;
+      job.end = begin + size;
+      Push(job);
+      begin += size;
+    }
+  }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+namespace Engine
+{
+  /**
+   * RadixSort - Sort 64-bit keys in O(n) with an LSD (least significant digit first) radix sort
+   *
+   * Why: Sorting draw commands every frame with std::sort is O(n log n) with unpredictable branches.
+   * Packing everything that decides the order into one integer key lets us sort with a few linear
+   * counting passes instead, one per byte.
+   *
+   * - Stable: keys that compare equal keep their input order
+   * - Only bytes [firstByte, 8) are sorted on. If the low bytes hold an index (e.g. "which command
+   *   is this") that is already ascending, skip them: stability keeps them in order for free.
+   * - A byte that is the same in every key (e.g. only one layer in use) costs one histogram, no pass
+   *
+   * `scratch` must be at least as large as `keys`. The sorted result always ends up in `keys`.
+   */
+  void RadixSort(std::span<std::uint64_t> keys, std::span<std::uint64_t> scratch, unsigned firstByte = 0);
+}
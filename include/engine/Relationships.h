@@ -0,0 +1,50 @@
+#pragma once
+
+#include <array>
+
+#include "Types.h"
+#include "Snapshot.h"
+
+/* What it does:
+ * - Links entities into parent → children trees (a ship and its weapons)
+ * - Answers "who is my parent" and "who are my children" in O(1) per step
+ *
+ * How it works:
+ * - Intrusive linked lists: every entity has a parent, a first child and prev/next sibling slots,
+ *   all in one flat array indexed by entity ID, so linking and unlinking never allocate
+ * - Coordinator::DestroyEntity() uses it to destroy children along with their parent, so nothing
+ *   is left pointing at a recycled ID
+ *
+ * Children are kept most-recently-attached first.
+ */
+namespace Engine
+{
+  class Relationships
+  {
+  public:
+    Relationships();
+
+    void SetParent(Entity child, Entity parent); // Moves the child if it already has a parent
+    void RemoveParent(Entity child);             // Does nothing if the child has no parent
+    void EntityDestroyed(Entity entity);         // Unlink from the parent (children must already be gone)
+
+    Entity GetParent(Entity child) const { return _links[child].parent; }           // NULL_ENTITY if none
+    Entity GetFirstChild(Entity parent) const { return _links[parent].firstChild; } // NULL_ENTITY if none
+    Entity GetNextSibling(Entity child) const { return _links[child].nextSibling; } // NULL_ENTITY after the last child
+
+    void Serialize(SnapshotWriter &writer) const; // Write every entity's links
+    bool Deserialize(SnapshotReader &reader);     // Restore every entity's links
+
+  private:
+    // Links are one entity's place in the trees.
+    struct Links
+    {
+      Entity parent = NULL_ENTITY;
+      Entity firstChild = NULL_ENTITY;
+      Entity previousSibling = NULL_ENTITY;
+      Entity nextSibling = NULL_ENTITY;
+    };
+
+    std::array<Links, MAX_ENTITIES> _links{}; // Indexed by entity ID
+  };
+}
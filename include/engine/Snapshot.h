@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+/*
+ * Snapshot helpers: a tiny binary writer/reader plus the per-component serialization hook
+ *
+ * Why: Coordinator::SaveSnapshot() dumps the whole ECS into one blob so a benchmark can jump straight
+ * into a pre-built scene. Components are plain structs stored in packed arrays, so for most of them the
+ * fastest possible format is "memcpy the array". Anything that can't be memcpy'd specializes
+ * ComponentSerializer<T> instead.
+ *
+ * The format is only meant to be read back by the same build (same component registration order,
+ * same struct layouts, same endianness). The header version and per-type sizes catch mismatches.
+ */
+namespace Engine
+{
+  // SnapshotWriter appends raw bytes to a growing buffer.
+  class SnapshotWriter
+  {
+  public:
+    explicit SnapshotWriter(std::vector<std::byte> &buffer) : _buffer(buffer) {}
+
+    void WriteBytes(const void *data, std::size_t size)
+    {
+      auto *bytes = static_cast<const std::byte *>(data);
+      _buffer.insert(_buffer.end(), bytes, bytes + size);
+    }
+
+    template <typename T>
+      requires std::is_trivially_copyable_v<T>
+    void Write(const T &value)
+    {
+      WriteBytes(&value, sizeof(T));
+    }
+
+  private:
+    std::vector<std::byte> &_buffer;
+  };
+
+  // SnapshotReader walks through a blob, failing (instead of reading past the end) on truncated data.
+  class SnapshotReader
+  {
+  public:
+    explicit SnapshotReader(std::span<const std::byte> data) : _data(data) {}
+
+    bool ReadBytes(void *destination, std::size_t size)
+    {
+      if (size > _data.size() - _offset)
+        return false;
+
+      std::memcpy(destination, _data.data() + _offset, size);
+      _offset += size;
+      return true;
+    }
+
+    template <typename T>
+      requires std::is_trivially_copyable_v<T>
+    bool Read(T &value)
+    {
+      return ReadBytes(&value, sizeof(T));
+    }
+
+    bool IsAtEnd() const { return _offset == _data.size(); }
+
+  private:
+    std::span<const std::byte> _data;
+    std::size_t _offset{};
+  };
+
+  /*
+   * ComponentSerializer<T>: how a packed array of T gets written to / read from a snapshot
+   *
+   * The default bulk-copies the whole array, which only works for trivially copyable components.
+   * For anything else, specialize it next to the component:
+   *
+   *   template <>
+   *   struct Engine::ComponentSerializer<Inventory>
+   *   {
+   *     static void Write(SnapshotWriter &writer, std::span<const Inventory> components) { ... }
+   *     static bool Read(SnapshotReader &reader, std::span<Inventory> components) { ... }
+   *   };
+   */
+  template <typename T>
+  struct ComponentSerializer
+  {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Component is not trivially copyable: specialize Engine::ComponentSerializer<T> for it");
+
+    static void Write(SnapshotWriter &writer, std::span<const T> components)
+    {
+      writer.WriteBytes(components.data(), components.size_bytes());
+    }
+
+    static bool Read(SnapshotReader &reader, std::span<T> components)
+    {
+      return reader.ReadBytes(components.data(), components.size_bytes());
+    }
+  };
+}
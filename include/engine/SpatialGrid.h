@@ -0,0 +1,91 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Engine
+{
+  /**
+   * SpatialGrid - A uniform grid for "who is near this point?" queries
+   *
+   * Why: Checking every agent against every other agent is O(n²). Bucketing points into cells
+   * the size of the query radius means a query only has to look at the 3x3 cells around it.
+   *
+   * How it works (rebuilt from scratch every frame, no per-cell allocations):
+   * - Build() computes the bounds of the points, counts points per cell, then does a counting sort
+   *   so every cell's points end up contiguous in _sortedX/_sortedY/_sortedIndex
+   * - ForEachCellNear() hands you those contiguous ranges, which is what makes SIMD loops over neighbors possible
+   *
+   * All buffers are kept between frames, so steady-state rebuilds don't touch the heap.
+   */
+  class SpatialGrid
+  {
+  public:
+    // CellRange is a run of points that share a cell: [begin, end) into the sorted arrays.
+    struct CellRange
+    {
+      std::uint32_t begin;
+      std::uint32_t end;
+    };
+
+    explicit SpatialGrid(float cellSize);
+
+    // Rebuild the grid from parallel x/y arrays. Index i in the queries refers to (xs[i], ys[i]).
+    void Build(std::span<const float> xs, std::span<const float> ys);
+
+    // Call visit(CellRange) for each non-empty cell in the 3x3 block around (x, y)
+    template <typename Visit>
+    void ForEachCellNear(float x, float y, Visit &&visit) const;
+
+    // Points sorted by cell (valid until the next Build)
+    std::span<const float> GetSortedX() const { return _sortedX; }
+    std::span<const float> GetSortedY() const { return _sortedY; }
+    std::span<const std::uint32_t> GetSortedIndices() const { return _sortedIndex; } // sorted slot → original index
+
+  private:
+    static constexpr std::int32_t MAX_CELLS_PER_AXIS = 1024; // Caps memory when points are spread very far apart
+
+    std::int32_t CellX(float x) const;
+    std::int32_t CellY(float y) const;
+
+    float _cellSize;                        // Requested cell size (usually the query radius)
+    float _inverseCellSize{};               // 1 / cell size actually used this frame
+    float _originX{};                       // World position of cell (0, 0)
+    float _originY{};
+    std::int32_t _columns{};
+    std::int32_t _rows{};
+
+    std::vector<std::uint32_t> _cellStart;   // Cell → first slot in the sorted arrays (size = cells + 1)
+    std::vector<std::uint32_t> _pointCell;   // Original index → cell (scratch for the counting sort)
+    std::vector<float> _sortedX;             // Point x, sorted by cell
+    std::vector<float> _sortedY;             // Point y, sorted by cell
+    std::vector<std::uint32_t> _sortedIndex; // Original index of each sorted slot
+  };
+
+  // =======================================================
+
+  template <typename Visit>
+  void SpatialGrid::ForEachCellNear(float x, float y, Visit &&visit) const
+  {
+    if (_columns == 0)
+      return;
+
+    std::int32_t centerX = CellX(x);
+    std::int32_t centerY = CellY(y);
+
+    for (std::int32_t cellY = std::max(centerY - 1, 0); cellY <= std::min(centerY + 1, _rows - 1); ++cellY)
+    {
+      for (std::int32_t cellX = std::max(centerX - 1, 0); cellX <= std::min(centerX + 1, _columns - 1); ++cellX)
+      {
+        std::size_t cell = static_cast<std::size_t>(cellY) * _columns + cellX;
+        CellRange range{_cellStart[cell], _cellStart[cell + 1]};
+        if (range.begin != range.end)
+        {
+          visit(range);
+        }
+      }
+    }
+  }
+}
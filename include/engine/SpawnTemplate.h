@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Types.h"
+
+namespace Engine
+{
+  class IComponentArray;
+
+  /**
+   * SpawnTemplate - A precompiled entity: its signature plus a packed byte image of its components
+   *
+   * Why: Building an entity with a chain of AddComponent() calls looks up each component array and
+   * re-matches the entity against every system once per component. A template does that work up front:
+   * Coordinator::Instantiate() copies each component's bytes straight into its array, then sets the
+   * signature and updates the systems once.
+   *
+   * - Fill it with Coordinator::SetTemplateComponent(), read values back with GetTemplateComponent()
+   * - Components must be trivially copyable (they're copied as raw bytes)
+   * - A template points at one Coordinator's component arrays: only instantiate it there
+   */
+  class SpawnTemplate
+  {
+  public:
+    // Entry is one component of the template: where its bytes are and which array they go into.
+    struct Entry
+    {
+      ComponentType type;
+      IComponentArray *array;
+      std::uint32_t offset; // Into the byte image
+      std::uint32_t size;
+    };
+
+    // Add a component's bytes, or overwrite them if the template already has this component type
+    void Set(ComponentType type, IComponentArray *array, const void *component, std::size_t size, std::size_t alignment);
+    const std::byte *Find(ComponentType type) const; // nullptr if the template doesn't have it
+
+    const Signature &GetSignature() const { return _signature; }
+    std::span<const Entry> GetEntries() const { return _entries; }
+    const std::byte *GetBytes(const Entry &entry) const { return _image.data() + entry.offset; }
+
+  private:
+    Signature _signature;
+    std::vector<Entry> _entries;
+    std::vector<std::byte> _image; // Every component back to back, each at its natural alignment
+  };
+}
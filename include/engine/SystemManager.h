@@ -1,12 +1,15 @@
 #pragma once
 
 #include <memory>
-#include <set>
+#include <string>
 #include <unordered_map>
 #include <typeindex>
+#include <vector>
 #include <cassert>
 
 #include "Types.h"
+#include "EntitySet.h"
+#include "Telemetry.h"
 
 namespace Engine
 {
@@ -27,8 +30,8 @@ namespace Engine
   class System
   {
   public:
-    std::set<Entity> _entities; // Which entities this system cares about
-                                // Updated automatically by SystemManager when entity signatures change
+    EntitySet _entities; // Which entities this system cares about
+                         // Updated automatically by SystemManager when entity signatures change
   };
 
   /*
@@ -50,6 +53,10 @@ namespace Engine
 
     void EntitySignatureChanged(Entity entity, const Signature &entitySignature);
 
+    void Clear(); // Empty every system's entity set (used before rebuilding them from a snapshot)
+
+    void CollectTelemetry(std::vector<Telemetry::SystemStats> &systems) const; // Entity count of every system, sorted by name
+
   private:
     std::unordered_map<std::type_index, std::shared_ptr<System>> _systems{};  // Map: system type → its implementation
                                                                               // Why: We need to store the actual System objects
@@ -58,6 +65,8 @@ namespace Engine
     std::unordered_map<std::type_index, Signature> _signatures{};             // Map: system type → its required component signature
                                                                               // Why: We need to know which components each system requires
                                                                               // Example: PhysicsSystem requires Transform and Velocity components
+
+    std::unordered_map<std::type_index, std::string> _names{};                // Map: system type → readable name (for telemetry)
   };
 
   // =======================================================
@@ -70,6 +79,7 @@ namespace Engine
 
     auto system = std::make_shared<T>();  // Create the system instance
     _systems.insert({typeIndex, system}); // Store it in our map
+    _names.insert({typeIndex, ReadableTypeName(typeid(T))});
 
     return system;                        // Return the system so the caller can configure it
   }
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <vector>
+
+namespace Engine
+{
+  /**
+   * Telemetry - A look at one world's ECS: how many entities, where they are, and how fast they churn
+   *
+   * Why: Tuning spawn rates and pool sizes needs live numbers, not a println whenever the entity count
+   * changes. Coordinator::CollectTelemetry() fills one of these once per frame; the per-frame counters
+   * cover everything since the previous call.
+   *
+   * Keep one Telemetry around and refill it: the vectors and names are reused, so after the first frame
+   * collecting doesn't allocate. Names point into the Coordinator, so they're valid as long as it is.
+   */
+  struct Telemetry
+  {
+    // SystemStats is one system and the number of entities it currently processes.
+    struct SystemStats
+    {
+      std::string_view name;
+      std::size_t entityCount;
+    };
+
+    // ComponentStats is one component array: how many slots are used out of how many are allocated, and its heap footprint.
+    struct ComponentStats
+    {
+      std::string_view name;
+      std::size_t size;
+      std::size_t capacity;
+      std::size_t bytes;     // Packed data + entity → index lookup held right now
+      std::size_t peakBytes; // Most it has ever held
+    };
+
+    // EventStats is one event type and how many of them were emitted last frame (what systems can read this frame).
+    struct EventStats
+    {
+      std::string_view name;
+      std::size_t count;
+    };
+
+    std::size_t livingEntities = 0;
+    std::size_t spawns = 0;           // Entities created (or reserved) this frame
+    std::size_t destroys = 0;         // Entities destroyed this frame
+    std::size_t signatureChanges = 0; // Component sets changed this frame (AddComponent, RemoveComponent, Instantiate)
+
+    std::vector<SystemStats> systems;       // Sorted by name
+    std::vector<ComponentStats> components; // In component type ID order
+    std::size_t componentBytes = 0;         // Sum of every array's bytes
+    std::vector<EventStats> events;         // In event registration order
+  };
+
+  // Type name without namespaces or compiler mangling ("Components::Transform" → "Transform"), for display
+  std::string ReadableTypeName(const std::type_info &type);
+}
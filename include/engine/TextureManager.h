@@ -2,36 +2,57 @@
 
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
 #include <string>
+#include <vector>
+
+#include "FileWatcher.h"
+#include "JobSystem.h"
 
 #include "game/TextureAssets.h"
 
 namespace Engine
 {
   /**
-   * TextureManager - Singleton class for managing game textures
+   * TextureManager - Owns the game's textures for one renderer
    * 
    * Handles loading, storing, and retrieving SDL textures. Automatically
    * cleans up all textures on destruction.
    * 
    * Usage:
-   *   auto& texManager = TextureManager::GetInstance();
-   *   texManager.Init(renderer);
-   *   texManager.LoadAllTextures();
+   *   TextureManager texManager;
+   *   texManager.Init(renderer, &jobs);
+   *   texManager.LoadManifest(TEXTURE_MANIFEST_PATH);
+   *   texManager.EnableHotReload();
    *   SDL_Texture* tex = texManager.Get(TextureID::Player);
+   *
+   * Decoding (the slow part of loading) runs on the JobSystem: LoadManifest() decodes every image at
+   * once, and only uploads them on the calling thread.
+   *
+   * Hot reload: a FileWatcher thread notices when an image is saved and hands decoding it to the
+   * JobSystem, off the main thread. The main thread calls ApplyPendingReloads() once per frame (a single
+   * atomic check when nothing changed), which uploads the new image and swaps it in under the
+   * same TextureID. Anything that looks textures up by ID each frame picks up the change for free.
    */
   class TextureManager
   {
   public:
-    // Get the singleton instance
-    static TextureManager &GetInstance();
+    TextureManager() = default;
+    ~TextureManager();
+
+    // Prevent copying
+    TextureManager(const TextureManager &) = delete;
+    TextureManager &operator=(const TextureManager &) = delete;
 
-    // Initialize with SDL renderer (required before loading textures)
-    void Init(SDL_Renderer *renderer);
+    // Initialize with SDL renderer (required before loading textures), and the jobs to decode images on
+    // (null decodes on the calling thread). The JobSystem must outlive the TextureManager.
+    void Init(SDL_Renderer *renderer, JobSystem *jobs = nullptr);
 
-    // Load all textures defined in TextureAssets map
-    void LoadAllTextures();
+    // Load every texture listed in a manifest ("<name> <path>" lines, see TextureAssets.h)
+    // Returns false if the manifest can't be read; bad lines are reported and skipped
+    bool LoadManifest(const std::string &manifestPath);
 
     // Load a single texture from file path
     // Returns true if successful or already loaded, false on error
@@ -45,19 +66,43 @@ namespace Engine
     // Remove a specific texture from memory
     void Unload(TextureID id);
 
-    // Clear all textures from memory (called automatically in destructor)
+    // Clear all textures from memory
     void Clear();
 
+    // Stop hot reload, wait for decodes still running, and clear everything. Call it before SDL_Quit()
+    // (the destructor calls it too, which is too late if SDL has already shut down).
+    void Shutdown();
+
+    // Start watching every loaded texture's file for changes
+    void EnableHotReload();
+
+    // Swap in textures that changed on disk. Main thread only, at a frame boundary.
+    // Returns the IDs that were replaced (usually none).
+    std::vector<TextureID> ApplyPendingReloads();
+
   private:
-    TextureManager() = default;
-    ~TextureManager();
+    // PendingReload is an image the watcher thread decoded, waiting for the main thread to upload it.
+    struct PendingReload
+    {
+      TextureID id;
+      SDL_Surface *surface;
+    };
 
-    // Prevent copying
-    TextureManager(const TextureManager &) = delete;
-    TextureManager &operator=(const TextureManager &) = delete;
+    SDL_Texture *CreateTexture(SDL_Surface *surface, const std::string &filepath) const;
+    bool AddTexture(TextureID id, SDL_Surface *surface, const std::string &filepath); // Uploads, then frees surface
+    void OnFileChanged(const std::string &path); // Watcher thread
+    static void DecodeReload(void *self, std::size_t id, std::size_t); // Job: decode _paths[id] into _pending
 
     SDL_Renderer *_renderer = nullptr;
+    JobSystem *_jobs = nullptr;
     std::unordered_map<TextureID, SDL_Texture *> _textures;
+    std::unordered_map<TextureID, std::string> _paths; // Where each texture was loaded from
+
+    FileWatcher _watcher;
+    JobCounter _reloadsDecoding;           // Hot reload decodes still running (waited for on destruction)
+    std::mutex _pendingMutex;
+    std::vector<PendingReload> _pending;   // Guarded by _pendingMutex
+    std::atomic<bool> _hasPending{false};  // Lets the per-frame check skip the lock
   };
 
 }
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <vector>
+
+#include "Camera.h"
+#include "TextureManager.h"
+
+namespace Engine
+{
+  /**
+   * Tilemap - A grid of tiles from one tileset texture, drawn from cached chunk textures
+   *
+   * Why: A background made of tiles means thousands of tiny draw calls per frame if every tile is
+   * drawn every time. Tiles almost never change, so we group them into chunks (CHUNK_TILES x CHUNK_TILES)
+   * and render each chunk once into its own target texture. A frame then draws only the handful
+   * of chunk textures that overlap the view.
+   *
+   * How it works:
+   * - SetTile() only marks the tile's chunk dirty
+   * - Draw() rebuilds dirty chunks that are in view (render-to-texture), then draws the visible chunks
+   * - Chunks are created lazily the first time they are seen
+   * - InvalidateChunks() after SDL_EVENT_RENDER_TARGETS_RESET, since the GPU may drop target textures
+   *
+   * The tileset is a TextureManager texture: tile i is the i-th tileSize square, left to right,
+   * top to bottom. All rendering happens here, so use a Tilemap from the main (render) thread only.
+   */
+  class Tilemap
+  {
+  public:
+    static constexpr std::int32_t CHUNK_TILES = 16;    // Tiles per chunk side
+    static constexpr std::uint16_t EMPTY = UINT16_MAX; // Tile index for "nothing here"
+
+    Tilemap(float tileSize, std::int32_t columns, std::int32_t rows);
+    ~Tilemap();
+
+    // Must be called before Draw(). The tileset texture must already be loaded.
+    void Init(SDL_Renderer *renderer, TextureManager *textureManager, TextureID tileset);
+
+    void SetTile(std::int32_t column, std::int32_t row, std::uint16_t tile);
+    std::uint16_t GetTile(std::int32_t column, std::int32_t row) const;
+
+    // Draw the part of the map the camera can see
+    void Draw(const Camera &camera);
+
+    void InvalidateChunks(); // Redraw every chunk on next use (render targets were lost)
+    void Release();          // Destroy all chunk textures
+
+    std::int32_t GetColumns() const { return _columns; }
+    std::int32_t GetRows() const { return _rows; }
+    float GetTileSize() const { return _tileSize; }
+
+  private:
+    // Chunk is the cached texture of one CHUNK_TILES x CHUNK_TILES block.
+    struct Chunk
+    {
+      SDL_Texture *texture = nullptr;
+      bool dirty = true;
+    };
+
+    bool RebuildChunk(std::int32_t chunkColumn, std::int32_t chunkRow);
+
+    float _tileSize;
+    std::int32_t _columns;
+    std::int32_t _rows;
+    std::int32_t _chunkColumns;
+    std::int32_t _chunkRows;
+
+    std::vector<std::uint16_t> _tiles; // Row-major, _columns * _rows
+    std::vector<Chunk> _chunks;        // Row-major, _chunkColumns * _chunkRows
+
+    SDL_Renderer *_renderer = nullptr;
+    TextureManager *_textureManager = nullptr;
+    TextureID _tileset{};
+    std::int32_t _tilesetColumns = 0;
+  };
+}
@@ -1,6 +1,8 @@
 #pragma once
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
+#include <type_traits>
 
 /*
  * Entity:
@@ -14,15 +16,30 @@
  *   A bitset tracking which components an entity has.
  *   Example: [1,1,0,0,...] means this entity has Transform and Velocity.
  *   Also used by systems to specify required components.
+ *
+ * CacheLinePacked:
+ *   A component whose size divides a cache line and that is aligned to its size. In a packed
+ *   array every one of them then sits inside exactly one line, so a loop over N of them touches
+ *   N * size / 64 lines and never splits a component across two. Hot components that already fit one
+ *   static_assert it; padding a bigger one out to the next size costs more bytes than it saves lines.
  */
 
 namespace Engine
 {
   using Entity = std::uint32_t;
-  constexpr Entity MAX_ENTITIES = 1000;
+  constexpr Entity MAX_ENTITIES = 100000;
+  constexpr Entity NULL_ENTITY = MAX_ENTITIES; // "No entity", e.g. the parent of an entity that has none
 
   using ComponentType = std::uint32_t;
   constexpr ComponentType MAX_COMPONENTS = 32;
 
   using Signature = std::bitset<MAX_COMPONENTS>;
+
+  constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+  template <typename T>
+  concept CacheLinePacked = std::is_trivially_copyable_v<T> &&
+                            sizeof(T) <= CACHE_LINE_SIZE &&
+                            CACHE_LINE_SIZE % sizeof(T) == 0 &&
+                            alignof(T) == sizeof(T);
 }
\ No newline at end of file
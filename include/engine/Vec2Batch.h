@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+#include "Vec2.h"
+
+namespace Engine
+{
+  /**
+   * Vec2Batch - Vec2 math over whole arrays at once
+   *
+   * Why: Vec2's operators work on one vector at a time, so a loop over thousands of entities
+   * uses one SIMD lane out of four (or eight). These functions take vectors in SoA form - all x
+   * in one span, all y in another - and process 4 (SSE2, NEON) or 8 (AVX2) of them per instruction.
+   *
+   * Usage: gather the data into scratch arrays (FrameArena), call a batch function, write back:
+   *   Vec2Batch::MulAdd(positionXs, positionYs, velocityXs, velocityYs, dt); // p += v * dt
+   *
+   * Backend is picked at compile time: AVX2 (configure with -DVEC2_AVX2=ON), else SSE2 on x86,
+   * else NEON on 64-bit ARM, else plain scalar code. Every backend runs the same formulas, so the
+   * leftover elements that don't fill a SIMD register get exactly the same treatment.
+   *
+   * Paired spans must have the same size. Output spans may alias the inputs.
+   */
+  namespace Vec2Batch
+  {
+    // xs/ys += otherXs/otherYs
+    void Add(std::span<float> xs, std::span<float> ys,
+             std::span<const float> otherXs, std::span<const float> otherYs);
+
+    // xs/ys += otherXs/otherYs * scale (e.g. position += velocity * dt)
+    void MulAdd(std::span<float> xs, std::span<float> ys,
+                std::span<const float> otherXs, std::span<const float> otherYs, float scale);
+
+    // lengths[i] = |(xs[i], ys[i])|
+    void Length(std::span<const float> xs, std::span<const float> ys, std::span<float> lengths);
+
+    // Normalize in place. Same threshold as Vec2::normalize(), but vectors too short to normalize
+    // become {0, 0} instead of being left as-is
+    void Normalize(std::span<float> xs, std::span<float> ys);
+
+    // angles[i] ~= std::atan2(ys[i], xs[i]) in radians, max error ~1.2e-5
+    void Atan2(std::span<const float> ys, std::span<const float> xs, std::span<float> angles);
+
+    // sines[i] ~= std::sin(angles[i]), cosines[i] ~= std::cos(angles[i]), max error ~4e-6
+    void SinCos(std::span<const float> angles, std::span<float> sines, std::span<float> cosines);
+
+    // Push away from every point within radius of `point`: sum of offset / distance² (points at
+    // distance ~0, e.g. the point itself, are skipped). Used for crowd separation.
+    Vec2 Repulsion(const Vec2 &point, std::span<const float> xs, std::span<const float> ys, float radius);
+
+    // Scalar versions of the approximations above, for code that only has one value
+    float FastAtan2(float y, float x);
+    void FastSinCos(float angle, float &sine, float &cosine);
+
+    // "AVX2", "SSE2", "NEON" or "Scalar"
+    const char *GetBackendName();
+  }
+}
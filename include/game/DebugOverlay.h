@@ -0,0 +1,16 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+
+#include "engine/Telemetry.h"
+
+/*
+ * DebugOverlay: the ECS telemetry drawn as text in the top-left corner (toggle with F3, or start with --telemetry)
+ *
+ * Uses SDL_RenderDebugText, so there's no font to load and nothing to allocate: each line is formatted
+ * into a stack buffer. Runs on the main thread, from the telemetry copied into the front render list.
+ */
+namespace DebugOverlay
+{
+  void Draw(SDL_Renderer *renderer, const Engine::Telemetry &telemetry);
+}
@@ -3,93 +3,112 @@
 #include "engine/Coordinator.h"
 #include "engine/Vec2.h"
 #include "game/Components.h"
+#include "game/Prefabs.h"
 #include "game/TextureAssets.h"
 
 // EntityCreator keeps helpers to spawn common game entities.
+// Component values come from the prefab file (see Prefabs.h); these helpers only fill in per-entity state.
+// Every helper spawns into the given world, from a prefab library loaded for that same world.
 namespace EntityCreator
 {
+
   // PlayerConfig keeps the basic values for creating the player.
   struct PlayerConfig
   {
     Engine::Vec2 position{0.0f, 0.0f};
-    float speed{300.0f};
   };
 
   // CreatePlayer sets up everything the player needs.
-  inline Engine::Entity CreatePlayer(const PlayerConfig &config = {})
+  inline Engine::Entity CreatePlayer(Engine::Coordinator &coordinator, const Prefabs::PrefabLibrary &prefabs,
+                                     const PlayerConfig &config = {})
   {
-    auto &coordinator = Engine::Coordinator::GetInstance();
-    Engine::Entity player = coordinator.CreateEntity();
+    Engine::Entity player = coordinator.Instantiate(prefabs.Get(Prefabs::PrefabID::Player));
 
-    coordinator.AddComponent<Components::Transform>(player, {.position = config.position});
-    coordinator.AddComponent<Components::Sprite>(player, {.textureId = TextureID::Player,
-                                                          .srcRect = {0.0f, 0.0f, 64.0f, 64.0f},
-                                                          .scaleMode = SDL_SCALEMODE_NEAREST,
-                                                          .flipMode = SDL_FLIP_NONE,
-                                                          .pivotPoint = {32.0f, 32.0f}});
+    coordinator.Get<Components::Transform>(player).position = config.position;
 
-    coordinator.AddComponent<Components::Speed>(player, {.value = config.speed});
-    coordinator.AddComponent<Components::Velocity>(player, {});
+    return player;
+  }
 
-    coordinator.AddComponent<Components::AimIntent>(player, {});
-    coordinator.AddComponent<Components::FireIntent>(player, {});
-    coordinator.AddComponent<Components::MoveIntent>(player, {});
+  // CreateLaserWeapon builds a laser weapon carried by the owner (and destroyed with it).
+  inline Engine::Entity CreateLaserWeapon(Engine::Coordinator &coordinator, const Prefabs::PrefabLibrary &prefabs,
+                                          Engine::Entity owner)
+  {
+    Engine::Entity weapon = coordinator.Instantiate(prefabs.Get(Prefabs::PrefabID::LaserWeapon));
 
-    coordinator.AddComponent<Components::Player>(player, {});
+    // The weapon is a child of its owner: WeaponSystem fires it when the owner wants to shoot.
+    coordinator.SetParent(weapon, owner);
 
-    return player;
+    return weapon;
   }
 
-  // CreateLaserWeapon builds a laser weapon tied to the owner.
-  inline Engine::Entity CreateLaserWeapon(Engine::Entity owner)
+  // TurretConfig keeps the values for an AI-less armed ship (used by the stress test).
+  struct TurretConfig
   {
-    auto &coordinator = Engine::Coordinator::GetInstance();
-    Engine::Entity weapon = coordinator.CreateEntity();
-
-    // Weapon stats keep firing and visual values together.
-    coordinator.AddComponent<Components::WeaponStats>(weapon, {.fireRate = 0.2f,           // 10 shots per second
-                                                               .projectileSpeed = 600.0f,  // Fast projectiles
-                                                               .projectileDamage = 10.0f,  // Damage per hit
-                                                               .projectileLifetime = 2.0f, // Lives for 2 seconds
-                                                               .projectileOffset = 50.0f,  // Offset from owner center (pixels)
-                                                               .projectileTexture = TextureID::LaserBeam,
-                                                               .projectileSrcRect = {0.0f, 0.0f, 16.0f, 16.0f},
-                                                               .projectilePivotPoint = {8.0f, 8.0f}});
+    Engine::Vec2 position{0.0f, 0.0f};
+    Engine::Vec2 aimTarget{0.0f, 0.0f};
+  };
 
-    // Cooldown starts at zero so it can fire immediately.
-    coordinator.AddComponent<Components::Cooldown>(weapon, {.remaining = 0.0f});
+  // CreateTurret builds a ship that never moves and fires its laser at a fixed point forever.
+  inline Engine::Entity CreateTurret(Engine::Coordinator &coordinator, const Prefabs::PrefabLibrary &prefabs,
+                                     const TurretConfig &config)
+  {
+    Engine::Entity turret = coordinator.Instantiate(prefabs.Get(Prefabs::PrefabID::Turret));
 
-    // OwnedBy links the weapon back to its owner.
-    coordinator.AddComponent<Components::OwnedBy>(weapon, {.owner = owner});
+    coordinator.Get<Components::Transform>(turret).position = config.position;
+    coordinator.Get<Components::AimIntent>(turret).target = config.aimTarget;
 
-    // Tag the entity as a weapon.
-    coordinator.AddComponent<Components::Weapon>(weapon, {});
+    CreateLaserWeapon(coordinator, prefabs, turret);
 
-    return weapon;
+    return turret;
   }
 
-  // CreateProjectile wires up a projectile with everything it needs.
-  inline Engine::Entity CreateProjectile(const Engine::Vec2 &position,
-                                         const Engine::Vec2 &direction,
-                                         const Components::WeaponStats &weaponStats,
-                                         const float rotation)
+  // EnemyConfig keeps the basic values for creating an enemy.
+  struct EnemyConfig
   {
-    auto &coordinator = Engine::Coordinator::GetInstance();
-    Engine::Entity projectile = coordinator.CreateEntity();
+    Engine::Vec2 position{0.0f, 0.0f};
+    float wanderAngle{0.0f}; // Starting wander heading (radians)
+    std::uint32_t seed{1};   // Seeds the enemy's wander randomness (must be non-zero)
+  };
 
-    coordinator.AddComponent<Components::Transform>(projectile, {.position = position, .rotation = rotation});
+  // CreateEnemy builds an AI ship that steers toward the player as part of a crowd.
+  inline Engine::Entity CreateEnemy(Engine::Coordinator &coordinator, const Prefabs::PrefabLibrary &prefabs,
+                                    const EnemyConfig &config)
+  {
+    Engine::Entity enemy = coordinator.Instantiate(prefabs.Get(Prefabs::PrefabID::Enemy));
 
-    coordinator.AddComponent<Components::Velocity>(projectile, {.vector = direction * weaponStats.projectileSpeed});
+    coordinator.Get<Components::Transform>(enemy).position = config.position;
 
-    coordinator.AddComponent<Components::Damage>(projectile, {.value = weaponStats.projectileDamage});
+    auto &steering = coordinator.Get<Components::AISteering>(enemy);
+    steering.wanderAngle = config.wanderAngle;
+    steering.randomState = config.seed;
 
-    coordinator.AddComponent<Components::Lifetime>(projectile, {.remaining = weaponStats.projectileLifetime});
+    return enemy;
+  }
 
-    coordinator.AddComponent<Components::Sprite>(projectile, {.textureId = weaponStats.projectileTexture,
-                                                              .srcRect = weaponStats.projectileSrcRect,
-                                                              .scaleMode = SDL_SCALEMODE_NEAREST,
-                                                              .flipMode = SDL_FLIP_NONE,
-                                                              .pivotPoint = weaponStats.projectilePivotPoint});
+  // CreateProjectile wires up a projectile with everything it needs.
+  inline Engine::Entity CreateProjectile(Engine::Coordinator &coordinator,
+                                         const Prefabs::PrefabLibrary &prefabs,
+                                         const Engine::Vec2 &position,
+                                         const Engine::Vec2 &direction,
+                                         const Components::WeaponStats &weaponStats,
+                                         const Components::WeaponVisuals *weaponVisuals,
+                                         const float rotation)
+  {
+    Engine::Entity projectile = coordinator.Instantiate(prefabs.Get(Prefabs::PrefabID::Projectile));
+
+    coordinator.Get<Components::Transform>(projectile) = {.position = position, .rotation = rotation};
+    coordinator.Get<Components::Velocity>(projectile).vector = direction * weaponStats.projectileSpeed;
+    coordinator.Get<Components::Damage>(projectile).value = weaponStats.projectileDamage;
+    coordinator.Get<Components::Lifetime>(projectile).remaining = weaponStats.projectileLifetime;
+
+    // The weapon decides what its shots look like (without WeaponVisuals they keep the projectile prefab's sprite)
+    if (weaponVisuals)
+    {
+      auto &sprite = coordinator.Get<Components::Sprite>(projectile);
+      sprite.textureId = weaponVisuals->projectileTexture;
+      sprite.srcRect = weaponVisuals->projectileSrcRect;
+      coordinator.Get<Components::Pivot>(projectile).point = weaponVisuals->projectilePivotPoint;
+    }
 
     return projectile;
   }
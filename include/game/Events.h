@@ -0,0 +1,51 @@
+#pragma once
+
+#include "engine/Types.h"
+#include "engine/Vec2.h"
+
+/*
+ * Events: what game systems tell each other through the world's Engine::EventBus
+ *
+ * Plain structs, emitted during one tick and read in bulk during the next (see EventBus.h), so the
+ * system that emits one never needs to know who listens. Entity IDs name the entity as it was when
+ * the event was emitted: it may have been destroyed since (check before using it).
+ */
+namespace Events
+{
+  // ShotFired: a weapon spawned a projectile at `position`, heading along `direction` (unit vector).
+  struct ShotFired
+  {
+    Engine::Entity weapon;
+    Engine::Vec2 position;
+    Engine::Vec2 direction;
+  };
+
+  // Expired: an entity's Lifetime ran out and it was destroyed at `position` (its sprite centre).
+  struct Expired
+  {
+    Engine::Entity entity;
+    Engine::Vec2 position;
+  };
+
+  // Hit: a projectile touched a target and was used up. DamageSystem applies `damage` to the target's Health.
+  struct Hit
+  {
+    Engine::Entity projectile;
+    Engine::Entity target;
+    float damage;
+    Engine::Vec2 position; // Where the projectile was
+  };
+
+  // Died: an entity's Health dropped to zero. It's destroyed at the end of the tick it died in.
+  struct Died
+  {
+    Engine::Entity entity;
+    Engine::Vec2 position; // Its sprite centre
+  };
+
+  // AimFailed: an owner wanted to fire but had no aim direction (its target was right on its centre).
+  struct AimFailed
+  {
+    Engine::Entity owner;
+  };
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "engine/Vec2.h"
+
+/*
+ * Input: per-tick player intents that can be sampled live, recorded to disk, or played back
+ *
+ * Why: PlayerInputSystem used to read SDL directly, so every run was different. Routing input through
+ * InputFrame means a recorded session can be replayed tick-for-tick with a fixed timestep, giving CI
+ * the exact same workload on every build (e.g. "strafe while holding fire for 10 minutes").
+ *
+ * Log format (host byte order, like snapshots: replay a log on the same kind of machine that recorded it):
+ *   header: "TDSI" magic, uint32 version, float timestep
+ *   frames: uint8 buttons, float aimX, float aimY   (9 bytes per tick)
+ */
+namespace Input
+{
+  // InputButton bit flags packed into InputFrame::buttons.
+  enum InputButton : std::uint8_t
+  {
+    MoveUp = 1 << 0,
+    MoveDown = 1 << 1,
+    MoveLeft = 1 << 2,
+    MoveRight = 1 << 3,
+    Fire = 1 << 4,
+    ZoomIn = 1 << 5,
+    ZoomOut = 1 << 6
+  };
+
+  // InputFrame holds everything the player asked for during one tick.
+  struct InputFrame
+  {
+    std::uint8_t buttons{0};            // InputButton flags
+    Engine::Vec2 aimTarget{0.0f, 0.0f}; // Cursor position in screen space (the camera maps it into the world)
+
+    bool IsDown(InputButton button) const { return (buttons & button) != 0; }
+  };
+
+  // SampleLive reads the current keyboard and mouse state from SDL (main thread only).
+  InputFrame SampleLive();
+
+  // InputRecorder appends one InputFrame per tick to a binary log.
+  class InputRecorder
+  {
+  public:
+    // Returns false if the file can't be created
+    bool Open(const std::string &filepath, float timestep);
+    void Write(const InputFrame &frame);
+    bool IsOpen() const;
+
+  private:
+    std::ofstream _file;
+  };
+
+  // InputPlayback reads a log written by InputRecorder back one tick at a time.
+  class InputPlayback
+  {
+  public:
+    // Returns false if the file is missing or isn't an input log
+    bool Open(const std::string &filepath);
+    // Returns false once the log runs out
+    bool Next(InputFrame &frame);
+    bool IsOpen() const;
+    float GetTimestep() const; // Timestep the log was recorded with
+
+  private:
+    std::ifstream _file;
+    float _timestep{0.0f};
+  };
+}
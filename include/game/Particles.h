@@ -0,0 +1,91 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "engine/Camera.h"
+#include "engine/Vec2.h"
+#include "game/RenderList.h"
+#include "game/TextureAssets.h"
+
+/*
+ * Particles: short-lived cosmetic effects (muzzle flashes, sparks) kept outside the ECS
+ *
+ * Why: A single shot can spawn a dozen particles that live for a fraction of a second. Making each
+ * one an entity would burn through the entity pool and pay component lookups for something that
+ * never interacts with gameplay. Instead every emitter owns plain SoA arrays:
+ * - Update() ages everything, swap-removes the dead, then moves the rest with Vec2Batch (SIMD)
+ * - Extract() turns the live particles into one indexed quad batch per emitter, which the render
+ *   thread draws with a single SDL_RenderGeometry call
+ *
+ * Buffers are sized once per emitter (maxParticles), so emitting never allocates; bursts that
+ * don't fit are trimmed. Particles are cosmetic: they're not part of snapshots.
+ *
+ * Belongs to the simulation tick, like the systems that emit into it. The tick moves particles in a
+ * job while it extracts sprites, so use it from one thread at a time.
+ */
+namespace Particles
+{
+  // Emitter picks the pool (texture, capacity, drag) a burst goes into.
+  enum class Emitter : std::uint8_t
+  {
+    MuzzleFlash,
+    Sparks,
+    Count
+  };
+
+  // Burst describes one emission: `count` particles fanning out from `position`.
+  struct Burst
+  {
+    Engine::Vec2 position;
+    Engine::Vec2 direction{1.0f, 0.0f}; // Centre of the fan (unit vector)
+    float spread{3.14159265f};          // Half-angle of the fan in radians (π = full circle)
+    float minSpeed{0.0f};
+    float maxSpeed{0.0f};
+    float minLifetime{0.1f};
+    float maxLifetime{0.1f};
+    float size{4.0f};                   // Quad width/height in pixels
+    SDL_FColor color{1.0f, 1.0f, 1.0f, 1.0f}; // Alpha fades to 0 over each particle's lifetime
+    std::uint32_t count{1};
+  };
+
+  // Presets used by the game systems
+  Burst MuzzleFlash(const Engine::Vec2 &position, const Engine::Vec2 &direction);
+  Burst Sparks(const Engine::Vec2 &position);
+  Burst Explosion(const Engine::Vec2 &position); // Bigger, hotter Sparks for a ship that died
+
+  class ParticleSystem
+  {
+  public:
+    ParticleSystem();
+
+    void Emit(Emitter emitter, const Burst &burst);
+    void Update(float dt);
+    void Extract(Rendering::RenderList &renderList, const Engine::Camera &camera) const; // One GeometryBatch per emitter, visible particles only
+
+    std::size_t GetParticleCount() const;
+
+  private:
+    // Pool holds one emitter's live particles as separate arrays, [0, count) alive.
+    struct Pool
+    {
+      TextureID texture;
+      std::size_t maxParticles = 0;
+      float drag = 0.0f; // Fraction of velocity lost per second
+      std::vector<float> positionX, positionY;
+      std::vector<float> velocityX, velocityY;
+      std::vector<float> age, lifetime, size;
+      std::vector<SDL_FColor> color;
+      std::size_t count = 0;
+    };
+
+    static void UpdatePool(Pool &pool, float dt);
+    float NextRandom01();
+
+    std::array<Pool, static_cast<std::size_t>(Emitter::Count)> _pools;
+    std::uint32_t _randomState = 0x9E3779B9u; // xorshift32: cosmetic, but still the same every run
+  };
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+#include "engine/Coordinator.h"
+#include "engine/SpawnTemplate.h"
+
+/*
+ * Prefabs: entity recipes loaded from a text file and compiled into spawn templates
+ *
+ * Why: Component values like a weapon's fire rate used to be hard-coded in EntityCreator, so every
+ * balance tweak meant a rebuild. Now they live in data/prefabs.txt:
+ *
+ *   [laser_weapon]
+ *   WeaponStats fireRate=0.2 projectileSpeed=600 ...
+ *   Cooldown    remaining=0
+ *
+ * Load() parses the file once at startup into one Engine::SpawnTemplate per prefab (signature + packed
+ * component bytes), so spawning is Coordinator::Instantiate(): a bulk copy instead of a chain of
+ * AddComponent() calls. EntityCreator then fills in per-entity values (position, aim, seeds).
+ *
+ * Templates bake in one Coordinator's component type IDs and arrays: register the components first,
+ * and only spawn from a library into the Coordinator it was loaded for.
+ */
+namespace Prefabs
+{
+  // Prefabs the game spawns by ID. Which components each one has is set in the prefab file.
+  enum class PrefabID : std::size_t
+  {
+    Player,
+    LaserWeapon,
+    Turret,
+    Enemy,
+    Projectile,
+    Count
+  };
+
+  inline constexpr const char *PREFABS_PATH = "../data/prefabs.txt";
+
+  // Section names used in the prefab file for each PrefabID
+  inline const std::unordered_map<std::string, PrefabID> PrefabNames =
+      {
+          {"player", PrefabID::Player},
+          {"laser_weapon", PrefabID::LaserWeapon},
+          {"turret", PrefabID::Turret},
+          {"enemy", PrefabID::Enemy},
+          {"projectile", PrefabID::Projectile}};
+
+  class PrefabLibrary
+  {
+  public:
+    // Parse the prefab file into templates for `coordinator`; fails (and keeps the old templates) on any error
+    bool Load(Engine::Coordinator &coordinator, const std::string &filepath);
+    const Engine::SpawnTemplate &Get(PrefabID id) const { return _templates[static_cast<std::size_t>(id)]; }
+
+  private:
+    std::array<Engine::SpawnTemplate, static_cast<std::size_t>(PrefabID::Count)> _templates;
+  };
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <vector>
+
+#include "engine/Camera.h"
+#include "engine/Telemetry.h"
+#include "game/TextureAssets.h"
+
+/*
+ * RenderList: everything the main thread needs to draw one frame, with no ECS access
+ *
+ * Why: The simulation runs on a worker thread while the main thread draws the previous frame.
+ * The render thread can't read Transform/Sprite while the simulation is writing them, so at the
+ * end of each tick RenderSystem copies what it needs into one of these (the "back" list).
+ * Game keeps two of them and swaps front/back once both threads are done.
+ */
+namespace Rendering
+{
+  // SpriteCommand is one textured quad, already resolved to screen space.
+  struct SpriteCommand
+  {
+    TextureID textureId;
+    SDL_FRect srcRect;
+    SDL_FRect dstRect;
+    float rotation;
+    SDL_FPoint pivotPoint;
+    SDL_FlipMode flipMode;
+  };
+
+  // GeometryBatch is one SDL_RenderGeometry call: many quads (4 vertices + 6 indices each) sharing a texture.
+  struct GeometryBatch
+  {
+    TextureID textureId;
+    std::vector<SDL_Vertex> vertices;
+    std::vector<int> indices;   // Only ever grows: the quad pattern is the same every frame
+    std::size_t indexCount = 0; // Indices actually used this frame
+  };
+
+  // RenderList holds every draw command for a single frame.
+  struct RenderList
+  {
+    std::vector<SpriteCommand> sprites;  // cleared (not freed) each tick, so capacity is reused
+    std::vector<GeometryBatch> geometry; // drawn after the sprites (particles)
+    Engine::Camera camera;               // the view this frame was extracted with (sprites/geometry are already in screen space)
+    Engine::Telemetry telemetry;         // ECS counters as of this tick (for the debug overlay)
+
+    void Clear()
+    {
+      sprites.clear();
+      for (auto &batch : geometry)
+      {
+        batch.vertices.clear();
+        batch.indexCount = 0;
+      }
+    }
+  };
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "engine/Coordinator.h"
+#include "engine/Vec2.h"
+#include "game/Prefabs.h"
+
+/*
+ * StressTest: ramps the entity population up to capacity and writes a scaling curve to CSV
+ *
+ * Why: We need to know where the engine's throughput knee is before designing levels.
+ * The scenario spawns turrets (armed ships that never stop firing) through EntityCreator, so the
+ * population is mostly real projectiles that move, render and expire like they do in game.
+ *
+ * Each step:
+ *   1. Spawn turrets until the expected steady-state population reaches the step's target
+ *   2. Run WARMUP ticks so the projectile population settles (projectiles live for 2 seconds)
+ *   3. Record simulation/render/frame time for MEASURE ticks and write one CSV row
+ *   4. Grow the target by growthFactor, until the entity pool's capacity is reached
+ */
+namespace StressTest
+{
+  // StressConfig holds the knobs for one run.
+  struct StressConfig
+  {
+    std::string csvPath{"stress.csv"};
+    std::size_t startEntities{1000};    // Population of the first step
+    float growthFactor{1.5f};           // Each step's target = previous target * growthFactor
+    float capacityFraction{0.95f};      // Stop at this fraction of MAX_ENTITIES (projectile counts fluctuate)
+    std::uint32_t warmupTicks{150};     // Ticks to settle before measuring each step
+    std::uint32_t measureTicks{300};    // Ticks measured per step
+    std::uint32_t seed{1234};           // Turret placement is random but repeatable
+  };
+
+  // StressScenario drives the ramp. Call Update() before each tick and RecordFrame() after it.
+  class StressScenario
+  {
+  public:
+    StressScenario(Engine::Coordinator &coordinator, const Prefabs::PrefabLibrary &prefabs,
+                   const StressConfig &config, Engine::Vec2 areaSize);
+
+    bool Open();                    // Create the CSV file and write its header
+    void Update();                  // Spawn turrets for the current step (main thread, simulation idle)
+    void RecordFrame(double simulationMs, double renderMs, double frameMs);
+    bool IsFinished() const;
+
+  private:
+    // FrameSample is the timing of one measured tick.
+    struct FrameSample
+    {
+      double simulationMs;
+      double renderMs;
+      double frameMs;
+    };
+
+    void SpawnTurrets(std::size_t count);
+    void WriteStepRow();
+    std::size_t EstimateEntitiesPerTurret() const;
+
+    Engine::Coordinator &_coordinator;       // World the turrets are spawned into
+    const Prefabs::PrefabLibrary &_prefabs;
+    StressConfig _config;
+    Engine::Vec2 _areaSize;
+    std::mt19937 _random;
+    std::ofstream _csv;
+
+    std::size_t _targetEntities{};     // Population this step is aiming for
+    std::size_t _maxEntities{};        // Last step's target (capacity * capacityFraction)
+    std::size_t _turretCount{};        // Turrets spawned so far
+    std::uint32_t _stepTick{};         // Ticks run in the current step
+    std::vector<FrameSample> _samples; // Measured ticks for the current step
+    bool _finished{false};
+  };
+}
@@ -5,42 +5,55 @@
 #include "game/Components.h"
 #include "engine/Coordinator.h"
 #include "engine/TextureManager.h"
+#include "engine/SpatialGrid.h"
+#include "engine/FlowField.h"
+#include "engine/JobSystem.h"
+#include "engine/Camera.h"
 #include "game/EntityCreator.h"
+#include "game/RenderList.h"
+#include "game/Input.h"
+#include "game/Events.h"
 #include <cmath>
+#include <span>
+#include <vector>
 
+// Systems hold no world state of their own: each call gets the Coordinator (world) to work on.
 namespace Systems
 {
-  // RenderSystem draws entities that have both Transform and Sprite.
+  // RenderSystem draws entities that have Transform, Sprite and Pivot.
+  // Extract() runs on the simulation thread, Draw() runs on the main thread.
   class RenderSystem : public Engine::System
   {
   public:
     void Init(SDL_Renderer *renderer, Engine::TextureManager *textureManager);
-    void Update();
+    // Copy visible Transform + Sprite + Pivot into a render list in screen space, sorted by layer/texture/depth
+    void Extract(Engine::Coordinator &coordinator, Rendering::RenderList &renderList, const Engine::Camera &camera) const;
+    void Draw(const Rendering::RenderList &renderList) const; // submit a render list to SDL
 
   private:
     SDL_Renderer *_renderer;
     Engine::TextureManager *_textureManager;
   };
 
-  // PlayerInputSystem handles WASD input and flags intent components.
+  // PlayerInputSystem turns a tick's input (live or replayed) into intent components.
   class PlayerInputSystem : public Engine::System
   {
   public:
-    void Update();
+    void Update(Engine::Coordinator &coordinator, const Input::InputFrame &input, const Engine::Camera &camera); // camera turns the cursor into a world position
   };
 
   // MovementSystem updates transforms based on current velocity.
   class MovementSystem : public Engine::System
   {
   public:
-    void Update(float dt);
+    void Update(Engine::Coordinator &coordinator, float dt);
   };
 
   // VelocitySystem converts move intents into actual velocity vectors.
   class VelocitySystem : public Engine::System
   {
   public:
-    void Update();
+    void Update(Engine::Coordinator &coordinator);
   };
 
   /**
@@ -50,27 +63,81 @@ namespace Systems
   class AimSystem : public Engine::System
   {
   public:
-    void Update();
+    void Update(Engine::Coordinator &coordinator);
   };
 
-  // WeaponSystem fires weapons when their owners want to shoot.
+  /**
+   * Steering System
+   * Blends seek (toward the target), separation (away from neighbours) and wander into each
+   * enemy's MoveIntent. Seek follows the shared flow field when one is given, and falls back to
+   * heading straight at the target where the field has no direction. Agents are processed as SoA batches so the distance and normalization
+   * math runs 4 at a time with SSE2, and neighbours come from a spatial grid instead of O(n²) checks.
+   */
+  class SteeringSystem : public Engine::System
+  {
+  public:
+    static constexpr float SEPARATION_RADIUS = 48.0f;        // Agents closer than this push each other apart
+    static constexpr std::size_t SEPARATION_CHUNK_SIZE = 1024; // Fewest agents worth handing to another thread
+
+    // A task: Start() it on `jobs`, then co_await its counter. The separation pass (the expensive one) runs
+    // in parallel, and the task suspends until it's done instead of holding a thread in Wait().
+    Engine::JobTask Update(Engine::Coordinator &coordinator, Engine::JobSystem &jobs, float dt, Engine::Vec2 target,
+                           const Engine::FlowField *flowField = nullptr);
+
+  private:
+    Engine::SpatialGrid _grid{SEPARATION_RADIUS}; // Rebuilt every tick, keeps its buffers between ticks
+  };
+
+  // WeaponSystem fires weapons when their owners (their parent entities) want to shoot.
   class WeaponSystem : public Engine::System
   {
   public:
-    void Update();
+    // Projectiles come from `prefabs`; emits Events::ShotFired for every shot, Events::AimFailed when an owner can't aim
+    void Update(Engine::Coordinator &coordinator, const Prefabs::PrefabLibrary &prefabs);
+  };
+
+  /**
+   * Collision System
+   * Finds projectiles (Transform + Damage) touching a target (Transform + Collider + Health). Targets are
+   * bucketed in a spatial grid, so each projectile only checks the 3x3 cells around it. A projectile hits
+   * at most one target (the nearest it overlaps) and is used up: it's queued for a deferred destroy.
+   */
+  class CollisionSystem : public Engine::System
+  {
+  public:
+    static constexpr float MAX_TARGET_RADIUS = 64.0f; // Grid cell size; bigger colliders are treated as this big
+
+    // This tick's hits, in projectile order (valid until the next Update). Also emitted as Events::Hit.
+    std::span<const Events::Hit> Update(Engine::Coordinator &coordinator, const Engine::EntitySet &targets);
+
+  private:
+    Engine::SpatialGrid _grid{MAX_TARGET_RADIUS}; // Rebuilt every tick, keeps its buffers between ticks
+    std::vector<Events::Hit> _hits;               // Cleared every tick, keeps its capacity
+  };
+
+  /**
+   * Damage System
+   * Applies a tick's hits in bulk: each hit's damage is scatter-added into a flat array laid out like the
+   * packed Health array, then every Health is updated in one linear pass. Anything that drops to zero emits
+   * Events::Died and is queued for a deferred destroy, so no system sees it disappear mid-loop.
+   */
+  class DamageSystem : public Engine::System
+  {
+  public:
+    void Update(Engine::Coordinator &coordinator, std::span<const Events::Hit> hits);
   };
 
   // CooldownSystem ticks down cooldown timers.
   class CooldownSystem : public Engine::System
   {
   public:
-    void Update(float dt);
+    void Update(Engine::Coordinator &coordinator, float dt);
   };
 
   // LifetimeSystem removes entities when their lifetime hits zero.
   class LifetimeSystem : public Engine::System
   {
   public:
-    void Update(float dt);
+    void Update(Engine::Coordinator &coordinator, float dt); // Emits Events::Expired for every entity it removes
   };
 }
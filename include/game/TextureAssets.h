@@ -1,17 +1,27 @@
 #pragma once
 
-#include <unordered_map>
+#include <cstdint>
 #include <string>
+#include <unordered_map>
 
-// Texture ID map and file paths used by the game.
-
-enum class TextureID
+// Texture IDs used by the game. Which file each one loads is set in the texture manifest.
+// One byte, so it packs next to the other small fields of a Sprite (the draw sort key has 8 bits for it too).
+enum class TextureID : std::uint8_t
 {
   Player,
-  LaserBeam
+  LaserBeam,
+  Particle,
+  Background
 };
 
-inline std::unordered_map<TextureID, std::string> TextureAssets =
+// Manifest file: one "<name> <image path>" line per texture, paths relative to the manifest.
+// Images listed there are hot-reloaded when they change on disk.
+inline constexpr const char *TEXTURE_MANIFEST_PATH = "../images/textures.manifest";
+
+// Names used in the manifest for each TextureID
+inline const std::unordered_map<std::string, TextureID> TextureNames =
     {
-        {TextureID::Player, "../images/spaceships/ship/purple.png"},
-        {TextureID::LaserBeam, "../images/laserbeam.png"}};
\ No newline at end of file
+        {"Player", TextureID::Player},
+        {"LaserBeam", TextureID::LaserBeam},
+        {"Particle", TextureID::Particle},
+        {"Background", TextureID::Background}};
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <SDL3/SDL.h>
+#include <cstdint>
 #include "game/TextureAssets.h"
+#include "engine/Types.h"
 #include "engine/Vec2.h"
 
 namespace Components
@@ -20,15 +22,34 @@ namespace Components
     Engine::Vec2 vector{0.0f, 0.0f};
   };
 
-  // Sprite describes which texture to draw and how to orient it.
+  // RenderLayer decides what draws on top: higher layers draw later.
+  enum class RenderLayer : std::uint8_t
+  {
+    Ground,
+    Projectiles,
+    Ships,
+    Overlay
+  };
+
+  // Sprite describes which part of which texture to draw. Cold for gameplay: only RenderSystem reads it.
   struct Sprite
   {
-    TextureID textureId;
     SDL_FRect srcRect;
-    SDL_ScaleMode scaleMode;
     SDL_FlipMode flipMode;
-    SDL_FPoint pivotPoint;
+    TextureID textureId;
+    RenderLayer layer{RenderLayer::Ships};
+    std::uint8_t padding[2]{}; // Spelled out so copies (and snapshots) never carry stray bytes
   };
+  static_assert(sizeof(Sprite) == 24, "Sprite is scanned every frame: keep it small");
+
+  // Pivot is the point a sprite rotates around, relative to its top-left (its centre, in practice).
+  // Hot: aiming and firing look it up per ship to find where the ship is, and drawing needs it too,
+  // so it lives apart from Sprite and a lookup loads 8 bytes instead of a whole Sprite.
+  struct alignas(8) Pivot
+  {
+    SDL_FPoint point;
+  };
+  static_assert(sizeof(Pivot) == 8 && Engine::CacheLinePacked<Pivot>, "Pivot is looked up per ship: keep it at 8 bytes");
 
   // Speed controls how fast the entity moves.
   struct Speed
@@ -42,6 +63,19 @@ namespace Components
     float value;
   };
 
+  // Health is how much damage the entity can take; at zero or below it dies (DamageSystem destroys it).
+  struct Health
+  {
+    float current;
+    float max;
+  };
+
+  // Collider makes the entity a target for projectiles: a circle around its sprite centre.
+  struct Collider
+  {
+    float radius;
+  };
+
   // Lifetime counts down until the entity expires.
   struct Lifetime
   {
@@ -73,29 +107,39 @@ namespace Components
     bool active{false};
   };
 
-  // WeaponStats groups firing and visual values in one place.
+  // WeaponStats is what a weapon needs to fire: how often, and how fast, hard and far its shots go.
+  // 20 bytes, deliberately not padded to 32 for CacheLinePacked (see Types.h).
   struct WeaponStats
   {
-    // Firing mechanics
     float fireRate;           // Time between shots (seconds)
     float projectileSpeed;    // Projectile velocity (pixels/second)
     float projectileDamage;   // Damage per projectile
     float projectileLifetime; // How long projectiles live (seconds)
     float projectileOffset;   // Offset from owner center (pixels)
+  };
+  static_assert(sizeof(WeaponStats) == 20, "WeaponStats is read for every weapon that fires: keep it to the firing values");
 
-    // Projectile visuals
-    TextureID projectileTexture;
+  // WeaponVisuals is what a weapon's shots look like. Cold: only read on the tick a shot is fired.
+  struct WeaponVisuals
+  {
     SDL_FRect projectileSrcRect;
     SDL_FPoint projectilePivotPoint;
+    TextureID projectileTexture;
+    std::uint8_t padding[3]{};
   };
 
-  // OwnedBy keeps a reference to the entity that owns this one.
-  struct OwnedBy
+  // AISteering tunes how an AI agent blends its steering behaviors into a MoveIntent.
+  struct AISteering
   {
-    Engine::Entity owner;
+    float seekWeight{1.0f};       // Pull toward the target (the player)
+    float separationWeight{1.5f}; // Push away from nearby agents so the crowd doesn't stack up
+    float wanderWeight{0.3f};     // Random drift so the crowd doesn't move in lockstep
+    float wanderAngle{0.0f};      // Current wander heading (radians), nudged a little every tick
+    std::uint32_t randomState{1}; // Per-agent xorshift state for the wander nudges (must be non-zero)
   };
 
   // Tags
   struct Player {}; // Player-controlled entity
   struct Weapon {}; // Weapon entity
+  struct Enemy {};  // AI-controlled hostile entity
 }
\ No newline at end of file
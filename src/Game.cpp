@@ -1,8 +1,14 @@
 #include "Game.h"
 #include "game/TextureAssets.h"
 #include "game/EntityCreator.h"
+#include "game/Events.h"
 #include "engine/TextureManager.h"
+#include "engine/AllocationTracker.h"
+#include <cmath>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <random>
 
 // Window configuration
 namespace Config
@@ -11,20 +17,89 @@ namespace Config
   constexpr int WINDOW_HEIGHT = 720;
   constexpr Uint32 WINDOW_FLAGS = SDL_WINDOW_RESIZABLE;
   constexpr const char *WINDOW_TITLE = "Top-Down Shooter";
+
+  // The world is much larger than the window; the camera scrolls around it
+  constexpr float ARENA_WIDTH = 3200.0f;
+  constexpr float ARENA_HEIGHT = 3200.0f;
+  constexpr float CAMERA_ZOOM_RATE = 1.5f; // Zoom keys scale zoom by e^(rate * seconds held)
+
+  // Timestep used while recording or replaying input, so runs are deterministic
+  constexpr float FIXED_TIMESTEP = 1.0f / 60.0f;
+
+  // Enemy pathfinding grid: cell size and how many cells a rebuild may expand per tick
+  constexpr float FLOW_FIELD_CELL_SIZE = 32.0f;
+  constexpr std::size_t FLOW_FIELD_CELLS_PER_TICK = 2048;
+
+  // Background tilemap: background.png is a 10x10 tileset of 50 px tiles, repeated across the arena
+  constexpr float BACKGROUND_TILE_SIZE = 50.0f;
+  constexpr std::int32_t BACKGROUND_TILESET_COLUMNS = 10;
+  constexpr std::int32_t BACKGROUND_TILESET_ROWS = 10;
+
+  // Ticks to ignore before expecting the frame arena to stop growing
+  constexpr Uint64 ARENA_WARMUP_TICKS = 120;
+
+  // How often component storage left over from a spike (e.g. a wave of projectiles) is given back
+  constexpr Uint64 SHRINK_INTERVAL_TICKS = 600;
 }
 
-bool Game::Init()
+// High resolution time since a SDL_GetPerformanceCounter() reading, in milliseconds
+static double ElapsedMilliseconds(Uint64 start)
+{
+  return (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+}
+
+Game::Game()
+    : _flowField({0.0f, 0.0f},
+                 Config::FLOW_FIELD_CELL_SIZE,
+                 static_cast<std::int32_t>(std::ceil(Config::ARENA_WIDTH / Config::FLOW_FIELD_CELL_SIZE)),
+                 static_cast<std::int32_t>(std::ceil(Config::ARENA_HEIGHT / Config::FLOW_FIELD_CELL_SIZE))),
+      _background(Config::BACKGROUND_TILE_SIZE,
+                  static_cast<std::int32_t>(std::ceil(Config::ARENA_WIDTH / Config::BACKGROUND_TILE_SIZE)),
+                  static_cast<std::int32_t>(std::ceil(Config::ARENA_HEIGHT / Config::BACKGROUND_TILE_SIZE))),
+      _camera(Engine::Vec2{Config::WINDOW_WIDTH, Config::WINDOW_HEIGHT})
+{
+}
+
+bool Game::Init(const Options &options)
 {
   if (!InitSDL())
   {
     Cleanup();
     return false;
   }
-  if (!InitECS())
+  if (!InitECS(options))
   {
     Cleanup();
     return false;
   }
+  if (!InitInput(options))
+  {
+    Cleanup();
+    return false;
+  }
+
+  // Start the camera on the player (the scene may have come from a snapshot)
+  _camera.SetBounds({0.0f, 0.0f, Config::ARENA_WIDTH, Config::ARENA_HEIGHT});
+  _camera.SnapTo(GetPlayerPosition());
+
+  _saveSnapshotPath = options.saveSnapshotPath;
+  _showTelemetry = options.showTelemetry;
+
+  if (!options.stressCsvPath.empty())
+  {
+    _stressScenario = std::make_unique<StressTest::StressScenario>(
+        _coordinator, _prefabs,
+        StressTest::StressConfig{.csvPath = options.stressCsvPath},
+        Engine::Vec2{Config::ARENA_WIDTH, Config::ARENA_HEIGHT});
+    if (!_stressScenario->Open())
+    {
+      Cleanup();
+      return false;
+    }
+
+    // Same workload per tick no matter how slow the frame was
+    _fixedTimestep = Config::FIXED_TIMESTEP;
+  }
   if (!LoadAssets())
   {
     Cleanup();
@@ -73,9 +148,43 @@ bool Game::InitSDL()
   return true;
 }
 
-bool Game::InitECS()
+bool Game::InitECS(const Options &options)
 {
-  auto &coordinator = Engine::Coordinator::GetInstance();
+  auto &coordinator = _coordinator;
+
+  // Register every component up front in a fixed order so component type IDs are the same on every run.
+  // Snapshots depend on this: they store component arrays by type ID.
+  coordinator.RegisterComponent<Components::Transform>();
+  coordinator.RegisterComponent<Components::Velocity>();
+  coordinator.RegisterComponent<Components::Sprite>();
+  coordinator.RegisterComponent<Components::Speed>();
+  coordinator.RegisterComponent<Components::Damage>();
+  coordinator.RegisterComponent<Components::Lifetime>();
+  coordinator.RegisterComponent<Components::Cooldown>();
+  coordinator.RegisterComponent<Components::MoveIntent>();
+  coordinator.RegisterComponent<Components::AimIntent>();
+  coordinator.RegisterComponent<Components::FireIntent>();
+  coordinator.RegisterComponent<Components::WeaponStats>();
+  coordinator.RegisterComponent<Components::Player>();
+  coordinator.RegisterComponent<Components::Weapon>();
+  coordinator.RegisterComponent<Components::AISteering>();
+  coordinator.RegisterComponent<Components::Enemy>();
+  coordinator.RegisterComponent<Components::WeaponVisuals>();
+  coordinator.RegisterComponent<Components::Health>();
+  coordinator.RegisterComponent<Components::Collider>();
+  coordinator.RegisterComponent<Components::Pivot>();
+
+  // Events too, so the telemetry overlay lists them in a fixed order
+  auto &events = coordinator.GetEvents();
+  events.RegisterEvent<Events::ShotFired>();
+  events.RegisterEvent<Events::Expired>();
+  events.RegisterEvent<Events::AimFailed>();
+  events.RegisterEvent<Events::Hit>();
+  events.RegisterEvent<Events::Died>();
+
+  // Prefabs bake in component type IDs, so they're compiled after registration
+  if (!_prefabs.Load(coordinator, Prefabs::PREFABS_PATH))
+    return false;
 
   // Register input system
   _playerInputSystem = coordinator.RegisterSystem<Systems::PlayerInputSystem,
@@ -88,7 +197,6 @@ bool Game::InitECS()
   _weaponSystem = coordinator.RegisterSystem<Systems::WeaponSystem,
                                              Components::Weapon,
                                              Components::Cooldown,
-                                             Components::OwnedBy,
                                              Components::WeaponStats>();
 
   // Register timer systems
@@ -103,6 +211,13 @@ bool Game::InitECS()
                                           Components::Transform,
                                           Components::AimIntent>();
 
+  // Steer enemy crowds toward the player
+  _steeringSystem = coordinator.RegisterSystem<Systems::SteeringSystem,
+                                               Components::Enemy,
+                                               Components::AISteering,
+                                               Components::Transform,
+                                               Components::MoveIntent>();
+
   // Update velocity's values based on the entity's move intent
   _velocitySystem = coordinator.RegisterSystem<Systems::VelocitySystem,
                                                  Components::MoveIntent,
@@ -114,46 +229,245 @@ bool Game::InitECS()
                                                Components::Transform,
                                                Components::Velocity>();
 
+  // Projectiles (anything with Damage) hit targets (anything with a Collider and Health)
+  _collisionSystem = coordinator.RegisterSystem<Systems::CollisionSystem,
+                                                Components::Transform,
+                                                Components::Damage>();
+
+  _damageSystem = coordinator.RegisterSystem<Systems::DamageSystem,
+                                             Components::Transform,
+                                             Components::Collider,
+                                             Components::Health>();
+
   // Render the entity's sprite
   _renderSystem = coordinator.RegisterSystem<Systems::RenderSystem,
                                              Components::Transform,
-                                             Components::Sprite>();
+                                             Components::Sprite,
+                                             Components::Pivot>();
+
+  // Keep the hot component pairs co-sorted so rendering and movement scan them linearly.
+  // Two groups can only share Transform if they nest, so movement uses the inner one
+  // (everything that moves has a sprite; MovementSystem handles any mover that doesn't).
+  coordinator.RegisterGroup<Components::Transform, Components::Sprite, Components::Pivot>();
+  coordinator.RegisterGroup<Components::Transform, Components::Sprite, Components::Pivot, Components::Velocity>();
 
   // Initialize render system with renderer and texture manager
-  _renderSystem->Init(_renderer, &Engine::TextureManager::GetInstance());
+  _renderSystem->Init(_renderer, &_textureManager);
+
+  // Start from a saved world instead of building the scene
+  if (!options.loadSnapshotPath.empty())
+  {
+    return LoadSnapshot(options.loadSnapshotPath);
+  }
 
   // Create player
-  Engine::Entity player = EntityCreator::CreatePlayer({.position = {Config::WINDOW_WIDTH / 2.0f, Config::WINDOW_HEIGHT / 2.0f}});
+  Engine::Entity player = EntityCreator::CreatePlayer(coordinator, _prefabs, {.position = {Config::ARENA_WIDTH / 2.0f, Config::ARENA_HEIGHT / 2.0f}});
 
   // Create weapon for player
-  EntityCreator::CreateLaserWeapon(player);
+  EntityCreator::CreateLaserWeapon(coordinator, _prefabs, player);
+
+  SpawnEnemies(options.enemyCount);
+
+  return true;
+}
+
+void Game::SpawnEnemies(std::size_t count)
+{
+  // The player and its weapon already exist; asking for more than the pool holds would run it dry
+  std::size_t capacity = Engine::MAX_ENTITIES - _coordinator.GetEntityCount();
+  if (count > capacity)
+  {
+    std::cerr << "Game::SpawnEnemies - Asked for " << count << " enemies, only room for " << capacity
+              << " (MAX_ENTITIES is " << Engine::MAX_ENTITIES << ")\n";
+    count = capacity;
+  }
+
+  std::mt19937 random(42); // Fixed seed so replays and benchmarks see the same horde
+  std::uniform_real_distribution<float> randomUnit(0.0f, 1.0f);
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    // Start somewhere along the edge of the arena
+    float along = randomUnit(random);
+    Engine::Vec2 position;
+    switch (i % 4)
+    {
+    case 0: position = {along * Config::ARENA_WIDTH, 0.0f}; break;
+    case 1: position = {along * Config::ARENA_WIDTH, Config::ARENA_HEIGHT}; break;
+    case 2: position = {0.0f, along * Config::ARENA_HEIGHT}; break;
+    default: position = {Config::ARENA_WIDTH, along * Config::ARENA_HEIGHT}; break;
+    }
+
+    EntityCreator::CreateEnemy(_coordinator, _prefabs,
+                               {.position = position,
+                                .wanderAngle = randomUnit(random) * 2.0f * static_cast<float>(M_PI),
+                                .seed = static_cast<std::uint32_t>(i + 1)});
+  }
+}
+
+Engine::Vec2 Game::GetPlayerPosition()
+{
+  for (const auto &player : _playerInputSystem->_entities)
+  {
+    if (auto *transform = _coordinator.GetOptional<Components::Transform>(player))
+    {
+      return transform->position;
+    }
+  }
+  return {Config::ARENA_WIDTH / 2.0f, Config::ARENA_HEIGHT / 2.0f};
+}
+
+bool Game::LoadSnapshot(const std::string &filepath)
+{
+  std::ifstream file(filepath, std::ios::binary);
+  if (!file)
+  {
+    std::cerr << "Failed to open snapshot '" << filepath << "'\n";
+    return false;
+  }
+
+  std::vector<char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  return _coordinator.LoadSnapshot(std::as_bytes(std::span(bytes)));
+}
+
+bool Game::SaveSnapshot(const std::string &filepath) const
+{
+  auto snapshot = _coordinator.SaveSnapshot();
+
+  std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+  if (!file.write(reinterpret_cast<const char *>(snapshot.data()), snapshot.size()))
+  {
+    std::cerr << "Failed to write snapshot '" << filepath << "'\n";
+    return false;
+  }
+
+  std::println("Saved {} byte snapshot to {}", snapshot.size(), filepath);
+  return true;
+}
+
+bool Game::InitInput(const Options &options)
+{
+  if (!options.recordInputPath.empty() && !options.replayInputPath.empty())
+  {
+    std::cerr << "Can't record and replay input at the same time\n";
+    return false;
+  }
+
+  // Replays run at the timestep they were recorded with, as fast as the machine allows
+  if (!options.replayInputPath.empty())
+  {
+    if (!_inputPlayback.Open(options.replayInputPath))
+      return false;
+    _fixedTimestep = _inputPlayback.GetTimestep();
+  }
+
+  if (!options.recordInputPath.empty())
+  {
+    if (!_inputRecorder.Open(options.recordInputPath, Config::FIXED_TIMESTEP))
+      return false;
+    _fixedTimestep = Config::FIXED_TIMESTEP;
+  }
 
   return true;
 }
 
 bool Game::LoadAssets()
 {
-  auto &texManager = Engine::TextureManager::GetInstance();
-  texManager.Init(_renderer);
-  texManager.LoadAllTextures();
+  _textureManager.Init(_renderer, &_jobs);
+  if (!_textureManager.LoadManifest(TEXTURE_MANIFEST_PATH))
+    return false;
+  _textureManager.EnableHotReload();
+
+  // Lay the tileset out in order, repeating, so the map shows background.png tiled across the arena
+  _background.Init(_renderer, &_textureManager, TextureID::Background);
+  for (std::int32_t row = 0; row < _background.GetRows(); ++row)
+  {
+    for (std::int32_t column = 0; column < _background.GetColumns(); ++column)
+    {
+      auto tile = (row % Config::BACKGROUND_TILESET_ROWS) * Config::BACKGROUND_TILESET_COLUMNS +
+                  column % Config::BACKGROUND_TILESET_COLUMNS;
+      _background.SetTile(column, row, static_cast<std::uint16_t>(tile));
+    }
+  }
 
   return true;
 }
 
 void Game::Run()
 {
-  float deltaTime = 0.0f;
+  float deltaTime = _fixedTimestep;
 
   while (_running)
   {
     Uint64 frameStart = SDL_GetTicks();
+    Uint64 framePerfStart = SDL_GetPerformanceCounter();
 
+    // SDL events and input state must be read on the main thread
+    Engine::AllocationTracker::SetPhase(Engine::FramePhase::Events);
     HandleEvents();
-    Update(deltaTime);
+    auto input = ReadInput();
+    if (!_running)
+      break;
+    _playerInputSystem->Update(_coordinator, input, _camera);
+
+    // Zoom is input too, so it is recorded and replayed with everything else
+    if (input.IsDown(Input::ZoomIn))
+      _camera.ZoomBy(std::exp(Config::CAMERA_ZOOM_RATE * deltaTime));
+    if (input.IsDown(Input::ZoomOut))
+      _camera.ZoomBy(std::exp(-Config::CAMERA_ZOOM_RATE * deltaTime));
+
+    // Stress test spawns happen here, while the simulation is idle
+    if (_stressScenario)
+    {
+      _stressScenario->Update();
+    }
+
+    // Simulate the next tick on the job system while we draw the last one.
+    // Frame time becomes max(simulation, render) instead of simulation + render.
+    {
+      Engine::AllocationTracker::ScopedPhase simulation(Engine::FramePhase::Simulation); // Its jobs count as Simulation
+      _jobs.Start(Update(deltaTime), _simulationDone);
+    }
+    Engine::AllocationTracker::SetPhase(Engine::FramePhase::Render);
+    Uint64 renderStart = SDL_GetPerformanceCounter();
     Render();
+    double renderMs = ElapsedMilliseconds(renderStart);
+    _jobs.Wait(_simulationDone); // Helps with whatever is left of the tick
+
+    // The tick is finished and nothing is drawing now, so it's safe to hand the new render list to the renderer
+    SwapRenderLists();
+
+    // Textures edited on disk are swapped in here, where no thread is drawing with them
+    for (TextureID reloaded : _textureManager.ApplyPendingReloads())
+    {
+      if (reloaded == TextureID::Background)
+        _background.InvalidateChunks(); // Chunks hold a baked copy of the old tileset
+    }
+
+    // Also safe here: compact component storage now and then, so a spike doesn't keep its memory for the whole session
+    if (_tickCount % Config::SHRINK_INTERVAL_TICKS == 0)
+    {
+      Engine::AllocationTracker::ScopedPhase maintenance(Engine::FramePhase::Maintenance);
+      _coordinator.Shrink();
+    }
+    Engine::AllocationTracker::EndFrame();
+
+    if (_stressScenario)
+    {
+      _stressScenario->RecordFrame(_lastSimulationMs, renderMs, ElapsedMilliseconds(framePerfStart));
+      _running = _running && !_stressScenario->IsFinished();
+    }
 
     Uint64 frameDuration = SDL_GetTicks() - frameStart;
-    deltaTime = frameDuration / 1000.0f;
+    deltaTime = (_fixedTimestep > 0.0f) ? _fixedTimestep : frameDuration / 1000.0f;
+  }
+
+  Engine::AllocationTracker::SetPhase(Engine::FramePhase::Startup);
+  Engine::AllocationTracker::Report();
+
+  if (!_saveSnapshotPath.empty())
+  {
+    SaveSnapshot(_saveSnapshotPath);
   }
 }
 
@@ -166,53 +480,179 @@ void Game::HandleEvents()
     {
       _running = false;
     }
+    else if (event.type == SDL_EVENT_KEY_DOWN && event.key.key == SDLK_F3 && !event.key.repeat)
+    {
+      // Debug view only, so it isn't part of the recorded input
+      _showTelemetry = !_showTelemetry;
+    }
+    else if (event.type == SDL_EVENT_RENDER_TARGETS_RESET || event.type == SDL_EVENT_RENDER_DEVICE_RESET)
+    {
+      // Cached chunk textures may have lost their contents
+      _background.InvalidateChunks();
+    }
   }
 }
 
-void Game::Update(float deltaTime)
+Input::InputFrame Game::ReadInput()
 {
-  // 1. Input: Read player input
-  _playerInputSystem->Update();
+  Input::InputFrame input;
+
+  // Replay: the log decides what the player does, and the game ends when it runs out
+  if (_inputPlayback.IsOpen())
+  {
+    if (!_inputPlayback.Next(input))
+    {
+      std::println("Input replay finished after {} ticks", _tickCount);
+      _running = false;
+    }
+    return input;
+  }
+
+  input = Input::SampleLive();
+  if (_inputRecorder.IsOpen())
+  {
+    _inputRecorder.Write(input);
+  }
+  return input;
+}
 
-  // 2. Decision: Calculate aim directions
-  _aimSystem->Update();
+// Runs as a job, on whichever thread is free. Player input has already been read on the main thread in Run().
+Engine::JobTask Game::Update(float deltaTime)
+{
+  Uint64 simulationStart = SDL_GetPerformanceCounter();
+
+  // 1. Decision: Calculate aim directions, while another thread refreshes the shared path to the player
+  //    (a bounded slice per tick). The flow field is outside the ECS, so the two never touch the same data.
+  Engine::Vec2 playerPosition = GetPlayerPosition();
+  _flowField.SetGoal(playerPosition);
+  Engine::JobCounter flowFieldStepped;
+  auto stepFlowField = [this] { _flowField.Step(Config::FLOW_FIELD_CELLS_PER_TICK); };
+  _jobs.Run(flowFieldStepped, stepFlowField);
+  _aimSystem->Update(_coordinator);
+  co_await flowFieldStepped;
+
+  // 2. AI: Steer enemies along the path (its separation pass spreads over the pool)
+  Engine::JobCounter steered;
+  _jobs.Start(_steeringSystem->Update(_coordinator, _jobs, deltaTime, playerPosition, &_flowField), steered);
+  co_await steered;
 
   // 3. Action: Fire weapons
-  _weaponSystem->Update();
+  _weaponSystem->Update(_coordinator, _prefabs);
 
   // 4. Movement: Convert intents to velocity, then move
-  _velocitySystem->Update();
-  _movementSystem->Update(deltaTime);
+  _velocitySystem->Update(_coordinator);
+  _movementSystem->Update(_coordinator, deltaTime);
+
+  // 5. Combat: projectiles touching a target hit it and are used up, then all of the tick's damage is applied at once
+  auto hits = _collisionSystem->Update(_coordinator, _damageSystem->_entities);
+  _damageSystem->Update(_coordinator, hits);
 
-  // 5. Timers: Update cooldowns and lifetimes
-  _cooldownSystem->Update(deltaTime);
-  _lifetimeSystem->Update(deltaTime);
+  // 6. Timers: Update cooldowns and lifetimes
+  _cooldownSystem->Update(_coordinator, deltaTime);
+  _lifetimeSystem->Update(_coordinator, deltaTime);
 
-  auto &coordinator = Engine::Coordinator::GetInstance();
+  // Spent projectiles and the dead go now, all together, before anything is drawn
+  _coordinator.FlushDestroyed();
 
-  auto entityCount = coordinator.GetEntityCount();
-  static auto prevEntityCount = entityCount;
-  if (entityCount != prevEntityCount)
+  // 7. Effects: Last tick's shots flash, hits and expired entities fizzle out, the dead burst apart;
+  //    then particles move and expire (outside the ECS, so another thread does that during extraction)
+  auto &events = _coordinator.GetEvents();
+  for (const auto &shot : events.Read<Events::ShotFired>())
+  {
+    _particles.Emit(Particles::Emitter::MuzzleFlash, Particles::MuzzleFlash(shot.position, shot.direction));
+  }
+  for (const auto &hit : events.Read<Events::Hit>())
+  {
+    _particles.Emit(Particles::Emitter::Sparks, Particles::Sparks(hit.position));
+  }
+  for (const auto &expired : events.Read<Events::Expired>())
   {
-    std::println("Entity count: {}", entityCount);
-    prevEntityCount = entityCount;
+    _particles.Emit(Particles::Emitter::Sparks, Particles::Sparks(expired.position));
   }
+  for (const auto &died : events.Read<Events::Died>())
+  {
+    _particles.Emit(Particles::Emitter::Sparks, Particles::Explosion(died.position));
+  }
+  if (auto aimFailures = events.Read<Events::AimFailed>(); !aimFailures.empty())
+  {
+    // Printing allocates, and it's a report, not part of the tick: keep it out of the simulation's audit
+    Engine::AllocationTracker::ScopedPhase diagnostics(Engine::FramePhase::Diagnostics);
+    for (const auto &failed : aimFailures)
+    {
+      std::cerr << "Invalid aim direction for entity " << failed.owner << "\n";
+    }
+  }
+  Engine::JobCounter particlesMoved;
+  auto moveParticles = [this, deltaTime] { _particles.Update(deltaTime); };
+  _jobs.Run(particlesMoved, moveParticles);
+
+  // 8. Extraction: Follow the player, then copy what the camera sees into the back render list
+  //    (sprites first: extracting them clears the list), and particles once they have moved
+  _camera.Follow(GetPlayerPosition(), deltaTime);
+  auto &backRenderList = _renderLists[1 - _frontRenderList];
+  _renderSystem->Extract(_coordinator, backRenderList, _camera);
+
+  // Telemetry is collected every tick (its counters are per tick), whether or not the overlay is showing
+  _coordinator.CollectTelemetry(backRenderList.telemetry);
+
+  co_await particlesMoved;
+  _particles.Extract(backRenderList, _camera);
+
+  // 9. End of tick: this tick's events become readable next tick, and everything systems allocated
+  //    from the frame arena is released
+  events.Swap();
+
+  auto &frameArena = _coordinator.GetFrameArena();
+#ifndef NDEBUG
+  // After warm-up the arena should be big enough that no frame spills to the heap
+  if (_tickCount > Config::ARENA_WARMUP_TICKS && frameArena.GetHeapAllocations() != _arenaHeapAllocations)
+  {
+    Engine::AllocationTracker::ScopedPhase diagnostics(Engine::FramePhase::Diagnostics);
+    std::cerr << "FrameArena spilled to the heap on tick " << _tickCount
+              << " (" << frameArena.GetUsedBytes() << " of " << frameArena.GetCapacity() << " bytes)\n";
+  }
+  _arenaHeapAllocations = frameArena.GetHeapAllocations();
+#endif
+  frameArena.Reset();
+  ++_tickCount;
+
+  _lastSimulationMs = ElapsedMilliseconds(simulationStart);
 }
 
-void Game::Render() const
+void Game::Render()
 {
   // Clear screen with dark gray color
   SDL_SetRenderDrawColor(_renderer, 25, 25, 25, 255);
   SDL_RenderClear(_renderer);
 
-  // Render all entities with the render system
-  _renderSystem->Update();
+  const auto &renderList = _renderLists[_frontRenderList];
+
+  // Background first: a few cached chunk textures, everything else draws on top
+  _background.Draw(renderList.camera);
+
+  // Draw the render list extracted at the end of the previous tick
+  _renderSystem->Draw(renderList);
+
+  if (_showTelemetry)
+  {
+    DebugOverlay::Draw(_renderer, renderList.telemetry);
+  }
 
   SDL_RenderPresent(_renderer);
 }
 
+void Game::SwapRenderLists()
+{
+  _frontRenderList = 1 - _frontRenderList;
+}
+
 void Game::Cleanup()
 {
+  // Chunk textures and loaded textures belong to the renderer, so they must go before it does.
+  // Shutting the texture manager down also stops hot reload, so no decode job calls SDL_image after SDL_Quit().
+  _background.Release();
+  _textureManager.Shutdown();
+
   if (_renderer)
   {
     SDL_DestroyRenderer(_renderer);
@@ -1,29 +1,65 @@
 #pragma once
 
 #include <SDL3/SDL.h>
+#include <array>
 #include <memory>
+#include <string>
 #include "engine/Coordinator.h"
+#include "engine/JobSystem.h"
+#include "engine/FlowField.h"
+#include "engine/Tilemap.h"
+#include "engine/Camera.h"
+#include "engine/TextureManager.h"
 #include "game/Systems.h"
 #include "game/Components.h"
+#include "game/RenderList.h"
+#include "game/Input.h"
+#include "game/Particles.h"
+#include "game/Prefabs.h"
+#include "game/StressTest.h"
+#include "game/DebugOverlay.h"
 
 class Game
 {
 public:
-  Game() = default;
+  // Launch options parsed from the command line (see main.cpp)
+  struct Options
+  {
+    std::string recordInputPath;  // --record <file>: log every tick's input
+    std::string replayInputPath;  // --replay <file>: drive the player from a log instead of SDL
+    std::string loadSnapshotPath; // --load-snapshot <file>: start from a saved world instead of the default scene
+    std::string saveSnapshotPath; // --save-snapshot <file>: save the world when the game exits
+    std::string stressCsvPath;    // --stress <file>: run the entity-count ramp and write its timings here
+    std::size_t enemyCount = 0;   // --enemies <count>: spawn an AI horde at startup
+    bool showTelemetry = false;   // --telemetry: start with the ECS telemetry overlay on (F3 toggles it)
+  };
+
+  Game();
   ~Game();
-  bool Init();
+  bool Init(const Options &options);
   void Run();
 
 private:
   // Initialization
   bool InitSDL();
-  bool InitECS();
+  bool InitECS(const Options &options);
+  bool InitInput(const Options &options);
   bool LoadAssets();
 
+  // Scene setup
+  void SpawnEnemies(std::size_t count);
+  Engine::Vec2 GetPlayerPosition();
+
+  // World snapshots
+  bool LoadSnapshot(const std::string &filepath);
+  bool SaveSnapshot(const std::string &filepath) const;
+
   // Game loop methods
   void HandleEvents();
-  void Update(float deltaTime);
-  void Render() const;
+  Input::InputFrame ReadInput();
+  Engine::JobTask Update(float deltaTime); // One simulation tick, run as a job (see Run())
+  void Render();
+  void SwapRenderLists();
   void Cleanup();
 
   // SDL members
@@ -31,6 +67,15 @@ private:
   SDL_Renderer *_renderer = nullptr;
   bool _running = false;
 
+  // One thread pool for the whole frame: the simulation tick, parallel loops inside systems and
+  // texture decoding all run on it. Declared first so it outlives everything that schedules jobs.
+  Engine::JobSystem _jobs;
+
+  // The ECS world this game simulates, and what it draws and spawns with
+  Engine::Coordinator _coordinator;
+  Engine::TextureManager _textureManager;
+  Prefabs::PrefabLibrary _prefabs;
+
   // Systems
   std::shared_ptr<Systems::PlayerInputSystem> _playerInputSystem;
   std::shared_ptr<Systems::CooldownSystem> _cooldownSystem;
@@ -39,5 +84,45 @@ private:
   std::shared_ptr<Systems::VelocitySystem> _velocitySystem;
   std::shared_ptr<Systems::MovementSystem> _movementSystem;
   std::shared_ptr<Systems::WeaponSystem> _weaponSystem;
+  std::shared_ptr<Systems::SteeringSystem> _steeringSystem;
+  std::shared_ptr<Systems::CollisionSystem> _collisionSystem;
+  std::shared_ptr<Systems::DamageSystem> _damageSystem;
   std::shared_ptr<Systems::RenderSystem> _renderSystem;
+
+  // Shared enemy pathfinding toward the player (covers the arena, one cell = FLOW_FIELD_CELL_SIZE pixels)
+  Engine::FlowField _flowField;
+
+  // Static background, drawn from cached chunk textures on the main thread
+  Engine::Tilemap _background;
+
+  // View into the arena: follows the player on the simulation thread, copied into each render list
+  Engine::Camera _camera;
+
+  // Cosmetic particles (muzzle flashes, sparks), updated by a job during extraction
+  Particles::ParticleSystem _particles;
+
+  // Pipelining: simulation of tick N+1 runs as a job while the main thread draws tick N
+  Engine::JobCounter _simulationDone;
+
+  // Double-buffered render state: the simulation writes the back list, Render() reads the front one
+  std::array<Rendering::RenderList, 2> _renderLists;
+  std::size_t _frontRenderList = 0;
+
+  // Input recording / replay (at most one is open)
+  Input::InputRecorder _inputRecorder;
+  Input::InputPlayback _inputPlayback;
+  float _fixedTimestep = 0.0f; // Seconds per tick when recording or replaying, 0 means use real frame time
+
+  std::string _saveSnapshotPath; // Where to save the world on exit (empty = don't)
+
+  // Stress test mode (null unless --stress was passed)
+  std::unique_ptr<StressTest::StressScenario> _stressScenario;
+  double _lastSimulationMs = 0.0; // Written by the simulation tick, read after waiting for it
+
+  // Simulation ticks completed so far
+  Uint64 _tickCount = 0;
+  // Frame arena heap fallbacks seen at the end of the previous tick (debug check only)
+  std::size_t _arenaHeapAllocations = 0;
+  // Draw the ECS telemetry overlay (F3)
+  bool _showTelemetry = false;
 };
\ No newline at end of file
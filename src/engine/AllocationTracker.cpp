@@ -0,0 +1,194 @@
+#include "engine/AllocationTracker.h"
+
+#ifdef ENGINE_TRACK_ALLOCATIONS
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+  constexpr std::size_t PHASE_COUNT = static_cast<std::size_t>(Engine::FramePhase::Count);
+
+  // Counters are plain relaxed atomics: the simulation and main threads allocate at the same time,
+  // and we only need the totals to be exact, not ordered.
+  struct PhaseCounters
+  {
+    std::atomic<std::uint64_t> allocations{};
+    std::atomic<std::uint64_t> deallocations{};
+    std::atomic<std::uint64_t> bytes{};
+  };
+
+  std::array<PhaseCounters, PHASE_COUNT> gTotals{};
+  std::array<std::atomic<std::uint64_t>, PHASE_COUNT> gFrameAllocations{}; // Reset by EndFrame()
+
+  std::atomic<std::uint64_t> gFrameIndex{};
+  std::atomic<std::uint64_t> gAllocatingFrames{}; // Frames after warm-up that allocated at least once
+
+  thread_local Engine::FramePhase tCurrentPhase = Engine::FramePhase::Startup;
+
+  void RecordAllocation(std::size_t bytes)
+  {
+    auto phase = static_cast<std::size_t>(tCurrentPhase);
+    gTotals[phase].allocations.fetch_add(1, std::memory_order_relaxed);
+    gTotals[phase].bytes.fetch_add(bytes, std::memory_order_relaxed);
+    gFrameAllocations[phase].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void RecordDeallocation()
+  {
+    auto phase = static_cast<std::size_t>(tCurrentPhase);
+    gTotals[phase].deallocations.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  const char *PhaseName(std::size_t phase)
+  {
+    constexpr std::array<const char *, PHASE_COUNT> names{"Startup", "Events", "Simulation", "Render", "Diagnostics", "Maintenance"};
+    return names[phase];
+  }
+
+  void *Allocate(std::size_t bytes)
+  {
+    RecordAllocation(bytes);
+    if (void *pointer = std::malloc(bytes ? bytes : 1))
+    {
+      return pointer;
+    }
+    throw std::bad_alloc();
+  }
+
+  void *AllocateAligned(std::size_t bytes, std::align_val_t alignment)
+  {
+    RecordAllocation(bytes);
+    auto align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+    void *pointer = _aligned_malloc(bytes ? bytes : 1, align);
+#else
+    // aligned_alloc wants the size to be a multiple of the alignment
+    std::size_t rounded = ((bytes ? bytes : 1) + align - 1) / align * align;
+    void *pointer = std::aligned_alloc(align, rounded);
+#endif
+    if (pointer)
+    {
+      return pointer;
+    }
+    throw std::bad_alloc();
+  }
+
+  void Free(void *pointer)
+  {
+    if (!pointer)
+      return;
+    RecordDeallocation();
+    std::free(pointer);
+  }
+
+  void FreeAligned(void *pointer)
+  {
+    if (!pointer)
+      return;
+    RecordDeallocation();
+#ifdef _WIN32
+    _aligned_free(pointer);
+#else
+    std::free(pointer);
+#endif
+  }
+}
+
+void Engine::AllocationTracker::SetPhase(FramePhase phase)
+{
+  tCurrentPhase = phase;
+}
+
+Engine::FramePhase Engine::AllocationTracker::GetPhase()
+{
+  return tCurrentPhase;
+}
+
+void Engine::AllocationTracker::EndFrame()
+{
+  std::uint64_t frame = gFrameIndex.fetch_add(1, std::memory_order_relaxed);
+
+  // Startup, Diagnostics and Maintenance don't count: the first is outside the loop, the others are opt-in
+  std::uint64_t frameAllocations = 0;
+  for (std::size_t phase = 0; phase < PHASE_COUNT; ++phase)
+  {
+    auto count = gFrameAllocations[phase].exchange(0, std::memory_order_relaxed);
+    if (phase != static_cast<std::size_t>(FramePhase::Startup) && phase != static_cast<std::size_t>(FramePhase::Diagnostics) &&
+        phase != static_cast<std::size_t>(FramePhase::Maintenance))
+    {
+      frameAllocations += count;
+    }
+  }
+
+  if (frame < WARMUP_FRAMES || frameAllocations == 0)
+    return;
+
+  gAllocatingFrames.fetch_add(1, std::memory_order_relaxed);
+
+#ifdef ENGINE_ALLOCATION_AUDIT
+  std::fprintf(stderr, "AllocationTracker: frame %llu allocated %llu times after warm-up\n",
+               static_cast<unsigned long long>(frame), static_cast<unsigned long long>(frameAllocations));
+  assert(false && "Steady-state frame allocated on the heap");
+#endif
+}
+
+Engine::PhaseStats Engine::AllocationTracker::GetStats(FramePhase phase)
+{
+  const auto &counters = gTotals[static_cast<std::size_t>(phase)];
+  return {.allocations = counters.allocations.load(std::memory_order_relaxed),
+          .deallocations = counters.deallocations.load(std::memory_order_relaxed),
+          .bytes = counters.bytes.load(std::memory_order_relaxed)};
+}
+
+void Engine::AllocationTracker::Report()
+{
+  // printf rather than iostream/println: the report itself must not allocate
+  std::printf("Allocation report (%llu frames, %llu allocating after warm-up):\n",
+              static_cast<unsigned long long>(gFrameIndex.load()),
+              static_cast<unsigned long long>(gAllocatingFrames.load()));
+
+  for (std::size_t phase = 0; phase < PHASE_COUNT; ++phase)
+  {
+    auto stats = GetStats(static_cast<FramePhase>(phase));
+    std::printf("  %-12s new: %10llu  delete: %10llu  bytes: %12llu\n", PhaseName(phase),
+                static_cast<unsigned long long>(stats.allocations),
+                static_cast<unsigned long long>(stats.deallocations),
+                static_cast<unsigned long long>(stats.bytes));
+  }
+}
+
+// =======================================================
+// Global operator new/delete replacements
+// =======================================================
+
+void *operator new(std::size_t bytes) { return Allocate(bytes); }
+void *operator new[](std::size_t bytes) { return Allocate(bytes); }
+void *operator new(std::size_t bytes, std::align_val_t alignment) { return AllocateAligned(bytes, alignment); }
+void *operator new[](std::size_t bytes, std::align_val_t alignment) { return AllocateAligned(bytes, alignment); }
+
+void *operator new(std::size_t bytes, const std::nothrow_t &) noexcept
+{
+  try { return Allocate(bytes); } catch (...) { return nullptr; }
+}
+void *operator new[](std::size_t bytes, const std::nothrow_t &) noexcept
+{
+  try { return Allocate(bytes); } catch (...) { return nullptr; }
+}
+
+void operator delete(void *pointer) noexcept { Free(pointer); }
+void operator delete[](void *pointer) noexcept { Free(pointer); }
+void operator delete(void *pointer, std::size_t) noexcept { Free(pointer); }
+void operator delete[](void *pointer, std::size_t) noexcept { Free(pointer); }
+void operator delete(void *pointer, const std::nothrow_t &) noexcept { Free(pointer); }
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept { Free(pointer); }
+void operator delete(void *pointer, std::align_val_t) noexcept { FreeAligned(pointer); }
+void operator delete[](void *pointer, std::align_val_t) noexcept { FreeAligned(pointer); }
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept { FreeAligned(pointer); }
+void operator delete[](void *pointer, std::size_t, std::align_val_t) noexcept { FreeAligned(pointer); }
+
+#endif
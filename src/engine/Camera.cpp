@@ -0,0 +1,71 @@
+#include "engine/Camera.h"
+
+#include <algorithm>
+#include <cmath>
+
+Engine::Camera::Camera(Vec2 viewportSize)
+    : _position(viewportSize / 2.0f),
+      _viewportSize(viewportSize)
+{
+}
+
+Engine::Vec2 Engine::Camera::WorldToScreen(const Vec2 &world) const
+{
+  return (world - _position) * _zoom + _viewportSize / 2.0f;
+}
+
+Engine::Vec2 Engine::Camera::ScreenToWorld(const Vec2 &screen) const
+{
+  return (screen - _viewportSize / 2.0f) / _zoom + _position;
+}
+
+SDL_FRect Engine::Camera::GetWorldView() const
+{
+  Vec2 size = _viewportSize / _zoom;
+  return {_position.x - size.x / 2.0f, _position.y - size.y / 2.0f, size.x, size.y};
+}
+
+void Engine::Camera::Follow(const Vec2 &target, float dt)
+{
+  // Exponential ease: the same fraction of the gap closes per second at any frame rate
+  float blend = 1.0f - std::exp(-_followSharpness * dt);
+  _position += (target - _position) * blend;
+  ClampToBounds();
+}
+
+void Engine::Camera::SnapTo(const Vec2 &target)
+{
+  _position = target;
+  ClampToBounds();
+}
+
+void Engine::Camera::ZoomBy(float factor)
+{
+  _zoom = std::clamp(_zoom * factor, MIN_ZOOM, MAX_ZOOM);
+  ClampToBounds();
+}
+
+void Engine::Camera::SetBounds(const SDL_FRect &worldBounds)
+{
+  _bounds = worldBounds;
+  ClampToBounds();
+}
+
+void Engine::Camera::ClampToBounds()
+{
+  if (_bounds.w <= 0.0f || _bounds.h <= 0.0f)
+    return;
+
+  // On each axis: keep the view inside the bounds, or centre it if the bounds are smaller than the view
+  Vec2 halfView = _viewportSize / (2.0f * _zoom);
+
+  if (_bounds.w <= 2.0f * halfView.x)
+    _position.x = _bounds.x + _bounds.w / 2.0f;
+  else
+    _position.x = std::clamp(_position.x, _bounds.x + halfView.x, _bounds.x + _bounds.w - halfView.x);
+
+  if (_bounds.h <= 2.0f * halfView.y)
+    _position.y = _bounds.y + _bounds.h / 2.0f;
+  else
+    _position.y = std::clamp(_position.y, _bounds.y + halfView.y, _bounds.y + _bounds.h - halfView.y);
+}
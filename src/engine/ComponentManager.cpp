@@ -1,6 +1,8 @@
 #include "engine/ComponentManager.h"
 #include "engine/Types.h"
 #include <cassert>
+#include <cstdint>
+#include <vector>
 
 void Engine::ComponentManager::EntityDestroyed(Entity entity)
 {
@@ -8,4 +10,64 @@ void Engine::ComponentManager::EntityDestroyed(Entity entity)
   {
     component->EntityDestroyed(entity);
   }
+}
+
+namespace
+{
+  // Component arrays ordered by their ComponentType ID, so the snapshot layout doesn't depend on hash map order
+  std::vector<Engine::IComponentArray *> ArraysByComponentType(
+      const std::unordered_map<std::type_index, Engine::ComponentType> &types,
+      const std::unordered_map<std::type_index, std::shared_ptr<Engine::IComponentArray>> &storage)
+  {
+    std::vector<Engine::IComponentArray *> arrays(types.size(), nullptr);
+    for (const auto &[typeIndex, componentType] : types)
+    {
+      arrays[componentType] = storage.at(typeIndex).get();
+    }
+    return arrays;
+  }
+}
+
+void Engine::ComponentManager::CollectTelemetry(std::vector<Telemetry::ComponentStats> &components) const
+{
+  components.resize(_componentTypes.size());
+  for (const auto &[typeIndex, componentType] : _componentTypes)
+  {
+    const auto &array = _componentStorage.at(typeIndex);
+    const auto memory = array->GetMemoryUsage();
+    components[componentType] = {_componentNames.at(typeIndex), array->Size(), array->Capacity(),
+                                 memory.denseBytes + memory.sparseBytes, memory.peakBytes};
+  }
+}
+
+void Engine::ComponentManager::Shrink()
+{
+  for (const auto &[type, component] : _componentStorage)
+  {
+    component->Shrink();
+  }
+}
+
+void Engine::ComponentManager::Serialize(SnapshotWriter &writer) const
+{
+  writer.Write(static_cast<std::uint32_t>(_nextComponentType));
+
+  for (const auto *array : ArraysByComponentType(_componentTypes, _componentStorage))
+  {
+    array->Serialize(writer);
+  }
+}
+
+bool Engine::ComponentManager::Deserialize(SnapshotReader &reader)
+{
+  std::uint32_t componentTypeCount = 0;
+  if (!reader.Read(componentTypeCount) || componentTypeCount != _nextComponentType)
+    return false;
+
+  for (auto *array : ArraysByComponentType(_componentTypes, _componentStorage))
+  {
+    if (!array->Deserialize(reader))
+      return false;
+  }
+  return true;
 }
\ No newline at end of file
@@ -1,10 +1,16 @@
 #include "engine/Coordinator.h"
+#include "engine/Snapshot.h"
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
 
-Engine::Coordinator &Engine::Coordinator::GetInstance()
+namespace
 {
-  static Coordinator instance;
-  return instance;
+  constexpr std::array<char, 4> kSnapshotMagic{'T', 'D', 'S', 'W'};
+  constexpr std::uint32_t kSnapshotVersion = 2; // 2: entity relationships
 }
 
 Engine::Coordinator::Coordinator()
@@ -12,6 +18,10 @@ Engine::Coordinator::Coordinator()
   _componentManager = std::make_unique<ComponentManager>();
   _entityManager = std::make_unique<EntityManager>();
   _systemManager = std::make_unique<SystemManager>();
+  _relationships = std::make_unique<Relationships>();
+  _frameArena = std::make_unique<FrameArena>();
+  _events = std::make_unique<EventBus>();
+  _pendingDestroy = std::make_unique<EntitySet>();
 }
 
 Engine::Entity Engine::Coordinator::CreateEntity()
@@ -19,15 +29,236 @@ Engine::Entity Engine::Coordinator::CreateEntity()
   return _entityManager->CreateEntity();
 }
 
+Engine::Entity Engine::Coordinator::ReserveEntity()
+{
+  return _entityManager->ReserveEntity();
+}
+
 void Engine::Coordinator::DestroyEntity(Entity entity)
 {
+  // Children go first, so nothing is left holding a parent ID that is about to be recycled
+  for (Entity child = _relationships->GetFirstChild(entity); child != NULL_ENTITY; child = _relationships->GetFirstChild(entity))
+  {
+    DestroyEntity(child);
+  }
+  _relationships->EntityDestroyed(entity);                   // Unlink from our own parent
+  _pendingDestroy->erase(entity);                            // Already gone: a queued destroy must not free the ID again
+
+  LeaveGroups(entity, Engine::Signature());                  // Out of the sorted ranges before its components go
   _systemManager->EntityDestroyed(entity);                   // Remove entity from all systems first
   _componentManager->EntityDestroyed(entity);                // Remove all components from entity
   _entityManager->SetSignature(entity, Engine::Signature()); // Reset the entity's signature
   _entityManager->DestroyEntity(entity);                     // Finally destroy the entity (this checks signature is empty)
 }
 
+void Engine::Coordinator::DestroyDeferred(Entity entity)
+{
+  _pendingDestroy->insert(entity);
+}
+
+void Engine::Coordinator::FlushDestroyed()
+{
+  // DestroyEntity() takes each entity (and any queued children) out of the set as it goes
+  while (!_pendingDestroy->empty())
+  {
+    DestroyEntity(*_pendingDestroy->begin());
+  }
+}
+
+Engine::Entity Engine::Coordinator::Instantiate(const SpawnTemplate &spawnTemplate)
+{
+  Entity entity = _entityManager->CreateEntity();
+  Instantiate(entity, spawnTemplate);
+
+  return entity;
+}
+
+void Engine::Coordinator::Instantiate(Entity entity, const SpawnTemplate &spawnTemplate)
+{
+  assert(_entityManager->GetSignature(entity).none() && "Instantiate into a fresh entity only.");
+
+  for (const auto &entry : spawnTemplate.GetEntries())
+  {
+    entry.array->AddElementBytes(entity, spawnTemplate.GetBytes(entry)); // Bulk copy, no per-type lookup
+  }
+
+  // One signature change for the whole entity, instead of one per AddComponent
+  _entityManager->SetSignature(entity, spawnTemplate.GetSignature());
+  _systemManager->EntitySignatureChanged(entity, spawnTemplate.GetSignature());
+  EnterGroups(entity, spawnTemplate.GetSignature());
+  ++_signatureChanges;
+}
+
+void Engine::Coordinator::SetParent(Entity child, Entity parent)
+{
+  _relationships->SetParent(child, parent);
+}
+
+void Engine::Coordinator::RemoveParent(Entity child)
+{
+  _relationships->RemoveParent(child);
+}
+
+Engine::Entity Engine::Coordinator::GetParent(Entity child) const
+{
+  return _relationships->GetParent(child);
+}
+
 size_t Engine::Coordinator::GetEntityCount() const
 {
   return _entityManager->GetLivingEntityCount();
+}
+
+Engine::FrameArena &Engine::Coordinator::GetFrameArena()
+{
+  return *_frameArena;
+}
+
+Engine::EventBus &Engine::Coordinator::GetEvents()
+{
+  return *_events;
+}
+
+void Engine::Coordinator::Shrink()
+{
+  _componentManager->Shrink();
+}
+
+void Engine::Coordinator::CollectTelemetry(Telemetry &telemetry)
+{
+  std::uint64_t created = _entityManager->GetCreatedCount();
+  std::uint64_t destroyed = _entityManager->GetDestroyedCount();
+
+  telemetry.livingEntities = _entityManager->GetLivingEntityCount();
+  telemetry.spawns = created - _collectedCreated;
+  telemetry.destroys = destroyed - _collectedDestroyed;
+  telemetry.signatureChanges = _signatureChanges - _collectedSignatureChanges;
+  _systemManager->CollectTelemetry(telemetry.systems);
+  _componentManager->CollectTelemetry(telemetry.components);
+  _events->CollectTelemetry(telemetry.events);
+
+  telemetry.componentBytes = 0;
+  for (const auto &component : telemetry.components)
+  {
+    telemetry.componentBytes += component.bytes;
+  }
+
+  _collectedCreated = created;
+  _collectedDestroyed = destroyed;
+  _collectedSignatureChanges = _signatureChanges;
+}
+
+// Layout: magic, version, MAX_ENTITIES, EntityManager state, relationships, then every component array (see ComponentArray::Serialize)
+std::vector<std::byte> Engine::Coordinator::SaveSnapshot() const
+{
+  std::vector<std::byte> snapshot;
+  SnapshotWriter writer(snapshot);
+
+  writer.Write(kSnapshotMagic);
+  writer.Write(kSnapshotVersion);
+  writer.Write(static_cast<std::uint32_t>(MAX_ENTITIES));
+
+  _entityManager->Serialize(writer);
+  _relationships->Serialize(writer);
+  _componentManager->Serialize(writer);
+
+  return snapshot;
+}
+
+bool Engine::Coordinator::LoadSnapshot(std::span<const std::byte> snapshot)
+{
+  SnapshotReader reader(snapshot);
+
+  std::array<char, 4> magic{};
+  std::uint32_t version = 0;
+  std::uint32_t maxEntities = 0;
+  if (!reader.Read(magic) || magic != kSnapshotMagic || !reader.Read(version) || version != kSnapshotVersion ||
+      !reader.Read(maxEntities) || maxEntities != MAX_ENTITIES)
+  {
+    std::cerr << "Coordinator::LoadSnapshot - Not a version " << kSnapshotVersion << " snapshot for this build\n";
+    return false;
+  }
+
+  if (!_entityManager->Deserialize(reader) || !_relationships->Deserialize(reader) ||
+      !_componentManager->Deserialize(reader) || !reader.IsAtEnd())
+  {
+    // A half-loaded world is useless, so callers should treat this as fatal
+    std::cerr << "Coordinator::LoadSnapshot - Snapshot is truncated or its components don't match this build\n";
+    return false;
+  }
+
+  // Systems are derived data: rebuild their entity sets from the restored signatures
+  _systemManager->Clear();
+  for (Entity entity = 0; entity < MAX_ENTITIES; ++entity)
+  {
+    const auto &signature = _entityManager->GetSignature(entity);
+    if (signature.any())
+    {
+      _systemManager->EntitySignatureChanged(entity, signature);
+    }
+  }
+  RebuildGroups(); // Group sizes aren't saved; the arrays come back already sorted, so this only recounts
+  _events->Clear(); // Pending events and destroys name entities from the world that was just replaced
+  _pendingDestroy->clear();
+
+  return true;
+}
+
+void Engine::Coordinator::AddGroup(Group group)
+{
+  const Signature &signature = group.GetSignature();
+  for (const auto &other : _groups)
+  {
+    Signature shared = other.GetSignature() & signature;
+    assert(other.GetSignature() != signature && "Group is already registered");
+    assert((shared.none() || shared == signature || shared == other.GetSignature()) &&
+           "Groups can only share components if one's components contain the other's");
+    (void)shared;
+  }
+
+  // Outer groups first: an inner group's members live inside its outer group's sorted range
+  auto position = std::find_if(_groups.begin(), _groups.end(), [&](const Group &other)
+                               { return other.GetSignature().count() > signature.count(); });
+  _groups.insert(position, std::move(group));
+
+  RebuildGroups();
+}
+
+const Engine::Group &Engine::Coordinator::FindGroup(const Signature &signature) const
+{
+  auto group = std::find_if(_groups.begin(), _groups.end(), [&](const Group &other)
+                            { return other.GetSignature() == signature; });
+  assert(group != _groups.end() && "Group is not registered");
+  return *group;
+}
+
+void Engine::Coordinator::EnterGroups(Entity entity, const Signature &signature)
+{
+  for (auto &group : _groups)
+  {
+    if ((signature & group.GetSignature()) == group.GetSignature() && !group.Contains(entity))
+    {
+      group.Enter(entity);
+    }
+  }
+}
+
+void Engine::Coordinator::LeaveGroups(Entity entity, const Signature &signature)
+{
+  // Inner groups first, so the entity leaves each range from the inside out
+  for (auto group = _groups.rbegin(); group != _groups.rend(); ++group)
+  {
+    if ((signature & group->GetSignature()) != group->GetSignature() && group->Contains(entity))
+    {
+      group->Leave(entity);
+    }
+  }
+}
+
+void Engine::Coordinator::RebuildGroups()
+{
+  for (auto &group : _groups)
+  {
+    group.Rebuild(*_entityManager);
+  }
 }
\ No newline at end of file
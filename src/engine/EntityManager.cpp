@@ -1,28 +1,48 @@
 #include "engine/EntityManager.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
 
 Engine::EntityManager::EntityManager()
 {
   // Initialize the entity ID pool with all available IDs (0 to MAX_ENTITIES-1)
   for (Entity entity = 0; entity < MAX_ENTITIES; ++entity)
   {
-    _entityIDs.push(entity);
+    _entityIDs[entity] = entity;
   }
+  _freeCount = MAX_ENTITIES;
 }
 
 Engine::Entity Engine::EntityManager::CreateEntity()
 {
-  assert(_livingEntityCount < MAX_ENTITIES && "Too many entities alive.");
+  Entity id = ReserveEntity();
+  assert(id != NULL_ENTITY && "Too many entities alive.");
 
-  // Get next available entity ID from the pool
-  Entity id = _entityIDs.front();
-  _entityIDs.pop();
+  return id;
+}
+
+Engine::Entity Engine::EntityManager::ReserveEntity()
+{
+  // Claim the next slot at the front of the free ring. While threads reserve, nothing else in the
+  // ring changes, so this counter is the only shared state and one fetch_add is the whole handshake.
+  size_t slot = _reserved.fetch_add(1, std::memory_order_relaxed);
+  if (slot >= _freeCount)
+    return NULL_ENTITY; // Pool is empty (CommitReservations() ignores the overshoot)
 
-  // Track the new living entity
-  ++_livingEntityCount;
+  return _entityIDs[(_freeHead + slot) % MAX_ENTITIES];
+}
 
-  return id;
+void Engine::EntityManager::CommitReservations()
+{
+  size_t reserved = std::min(_reserved.load(std::memory_order_relaxed), _freeCount);
+
+  // Reserved IDs are living entities now: take them off the front of the ring
+  _freeHead = (_freeHead + reserved) % MAX_ENTITIES;
+  _freeCount -= reserved;
+  _livingEntityCount += reserved;
+  _createdCount += reserved;
+  _reserved.store(0, std::memory_order_relaxed);
 }
 
 void Engine::EntityManager::DestroyEntity(Entity entity)
@@ -31,6 +51,8 @@ void Engine::EntityManager::DestroyEntity(Entity entity)
 
   assert(_signatures[entity].none() && "You're trying to destroy an entity with active components.");
 
+  CommitReservations(); // The freed ID goes behind every reserved one
+
   // Since the entity carries it's own valid signature when living
   // must reset the entities signature
 
@@ -39,8 +61,10 @@ void Engine::EntityManager::DestroyEntity(Entity entity)
 
   // reuse the id before entity is destroyed
   // push the now unused id to the back of the queue
-  _entityIDs.push(entity);
+  _entityIDs[(_freeHead + _freeCount) % MAX_ENTITIES] = entity;
+  ++_freeCount;
   --_livingEntityCount;
+  ++_destroyedCount;
 }
 
 void Engine::EntityManager::SetSignature(Entity entity, const Signature &signature)
@@ -59,7 +83,55 @@ const Engine::Signature &Engine::EntityManager::GetSignature(Entity entity) cons
   return _signatures[entity];
 }
 
+std::uint64_t Engine::EntityManager::GetCreatedCount() const
+{
+  return _createdCount + std::min(_reserved.load(std::memory_order_relaxed), _freeCount);
+}
+
 size_t Engine::EntityManager::GetLivingEntityCount() const
 {
-  return _livingEntityCount;
+  return _livingEntityCount + std::min(_reserved.load(std::memory_order_relaxed), _freeCount);
+}
+
+void Engine::EntityManager::Serialize(SnapshotWriter &writer) const
+{
+  static_assert(MAX_COMPONENTS <= 64, "Signatures are stored as 64-bit masks in snapshots");
+
+  // Write the state as if pending reservations were committed
+  size_t reserved = std::min(_reserved.load(std::memory_order_relaxed), _freeCount);
+  writer.Write(static_cast<std::uint64_t>(_livingEntityCount + reserved));
+  writer.Write(static_cast<std::uint64_t>((_freeHead + reserved) % MAX_ENTITIES));
+  writer.Write(static_cast<std::uint64_t>(_freeCount - reserved));
+  writer.WriteBytes(_entityIDs.data(), sizeof(_entityIDs));
+
+  // std::bitset's layout isn't specified, so store each signature as a plain integer mask
+  for (const auto &signature : _signatures)
+  {
+    writer.Write(static_cast<std::uint64_t>(signature.to_ullong()));
+  }
+}
+
+bool Engine::EntityManager::Deserialize(SnapshotReader &reader)
+{
+  std::uint64_t livingEntityCount = 0;
+  std::uint64_t freeHead = 0;
+  std::uint64_t freeCount = 0;
+  if (!reader.Read(livingEntityCount) || !reader.Read(freeHead) || !reader.Read(freeCount) ||
+      livingEntityCount + freeCount != MAX_ENTITIES || freeHead >= MAX_ENTITIES ||
+      !reader.ReadBytes(_entityIDs.data(), sizeof(_entityIDs)))
+    return false;
+
+  for (auto &signature : _signatures)
+  {
+    std::uint64_t mask = 0;
+    if (!reader.Read(mask))
+      return false;
+    signature = Signature(mask);
+  }
+
+  _livingEntityCount = livingEntityCount;
+  _freeHead = freeHead;
+  _freeCount = freeCount;
+  _reserved.store(0, std::memory_order_relaxed);
+  return true;
 }
\ No newline at end of file
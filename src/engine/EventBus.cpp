@@ -0,0 +1,26 @@
+#include "engine/EventBus.h"
+
+void Engine::EventBus::Swap()
+{
+  for (const auto &queue : _queues)
+  {
+    queue->Swap();
+  }
+}
+
+void Engine::EventBus::Clear()
+{
+  for (const auto &queue : _queues)
+  {
+    queue->Clear();
+  }
+}
+
+void Engine::EventBus::CollectTelemetry(std::vector<Telemetry::EventStats> &events) const
+{
+  events.resize(_queues.size());
+  for (std::size_t i = 0; i < _queues.size(); ++i)
+  {
+    events[i] = {_names[i], _queues[i]->ReadableCount()};
+  }
+}
@@ -0,0 +1,138 @@
+#include "engine/FileWatcher.h"
+
+#include <filesystem>
+#include <iostream>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+  // Same spelling for a path whether it came from Watch() or from an inotify event
+  std::string NormalizePath(const std::filesystem::path &path)
+  {
+    return path.lexically_normal().generic_string();
+  }
+
+  std::filesystem::path DirectoryOf(const std::filesystem::path &path)
+  {
+    return path.has_parent_path() ? path.parent_path() : std::filesystem::path(".");
+  }
+}
+
+Engine::FileWatcher::~FileWatcher()
+{
+  Stop();
+}
+
+void Engine::FileWatcher::Watch(const std::string &path)
+{
+  std::filesystem::path file(path);
+  _files.insert(NormalizePath(DirectoryOf(file) / file.filename()));
+}
+
+#ifdef __linux__
+
+bool Engine::FileWatcher::Start(Callback onChanged)
+{
+  if (_thread.joinable())
+    return true;
+
+  _inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (_inotify < 0)
+  {
+    std::cerr << "FileWatcher::Start - inotify_init1 failed\n";
+    return false;
+  }
+
+  // One watch per directory, however many files in it we care about
+  std::unordered_set<std::string> directories;
+  for (const auto &file : _files)
+  {
+    directories.insert(NormalizePath(DirectoryOf(file)));
+  }
+  for (const auto &directory : directories)
+  {
+    int watch = inotify_add_watch(_inotify, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+    if (watch < 0)
+    {
+      std::cerr << "FileWatcher::Start - Can't watch '" << directory << "'\n";
+      continue;
+    }
+    _directoryByWatch[watch] = directory;
+  }
+
+  _onChanged = std::move(onChanged);
+  _stopping = false;
+  _thread = std::thread(&FileWatcher::Run, this);
+  return true;
+}
+
+void Engine::FileWatcher::Stop()
+{
+  if (_thread.joinable())
+  {
+    _stopping = true;
+    _thread.join();
+  }
+  if (_inotify >= 0)
+  {
+    close(_inotify); // Also drops every watch
+    _inotify = -1;
+  }
+  _directoryByWatch.clear();
+}
+
+void Engine::FileWatcher::Run()
+{
+  // Wake up at least this often to notice Stop()
+  constexpr int kPollTimeoutMs = 100;
+
+  alignas(inotify_event) char buffer[4096];
+  pollfd descriptor{_inotify, POLLIN, 0};
+
+  while (!_stopping)
+  {
+    if (poll(&descriptor, 1, kPollTimeoutMs) <= 0)
+      continue;
+
+    ssize_t length = read(_inotify, buffer, sizeof(buffer));
+    for (ssize_t offset = 0; offset < length;)
+    {
+      const auto *event = reinterpret_cast<const inotify_event *>(buffer + offset);
+      offset += sizeof(inotify_event) + event->len;
+
+      auto directory = _directoryByWatch.find(event->wd);
+      if (event->len == 0 || directory == _directoryByWatch.end())
+        continue;
+
+      std::string path = NormalizePath(std::filesystem::path(directory->second) / event->name);
+      if (_files.contains(path))
+      {
+        _onChanged(path);
+      }
+    }
+  }
+}
+
+#else
+
+bool Engine::FileWatcher::Start(Callback onChanged)
+{
+  (void)onChanged;
+  std::cerr << "FileWatcher::Start - File watching is only supported on Linux; hot reload is off\n";
+  return false;
+}
+
+void Engine::FileWatcher::Stop()
+{
+}
+
+void Engine::FileWatcher::Run()
+{
+}
+
+#endif
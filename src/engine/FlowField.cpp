@@ -0,0 +1,185 @@
+#include "engine/FlowField.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+
+namespace
+{
+  // Neighbour offsets (column, row) and the cost multiplier for each: 10 straight, 14 ≈ 10·√2 diagonal
+  struct NeighbourOffset
+  {
+    std::int32_t column;
+    std::int32_t row;
+    std::uint32_t stepCost;
+  };
+
+  constexpr std::array<NeighbourOffset, 8> kNeighbours{{{1, 0, 10}, {-1, 0, 10}, {0, 1, 10}, {0, -1, 10},
+                                                        {1, 1, 14}, {-1, 1, 14}, {1, -1, 14}, {-1, -1, 14}}};
+}
+
+Engine::FlowField::FlowField(Vec2 origin, float cellSize, std::int32_t columns, std::int32_t rows)
+    : _origin(origin),
+      _cellSize(cellSize),
+      _inverseCellSize(1.0f / cellSize),
+      _columns(columns),
+      _rows(rows)
+{
+  assert(cellSize > 0.0f && columns > 0 && rows > 0 && "FlowField needs a non-empty grid");
+
+  const std::size_t cellCount = static_cast<std::size_t>(columns) * rows;
+  _costs.assign(cellCount, 1);
+  _distances.assign(cellCount, UNREACHED);
+  _directions.assign(cellCount, Vec2{});
+  _pendingDirections.assign(cellCount, Vec2{});
+  _queue.reserve(cellCount);
+}
+
+void Engine::FlowField::SetCost(std::int32_t column, std::int32_t row, std::uint8_t cost)
+{
+  assert(column >= 0 && column < _columns && row >= 0 && row < _rows && "FlowField cell is out of range");
+
+  _costs[static_cast<std::size_t>(row) * _columns + column] = cost;
+  if (_goalCell >= 0)
+  {
+    _dirty = true;
+  }
+}
+
+void Engine::FlowField::SetGoal(const Vec2 &worldPosition)
+{
+  std::int32_t cell = CellIndex(worldPosition);
+  if (cell < 0 || cell == _goalCell)
+    return; // Same cell (or off the grid): the current field is still correct
+
+  _goalCell = cell;
+  _dirty = true;
+}
+
+void Engine::FlowField::Step(std::size_t cellBudget)
+{
+  // Restart as soon as we know the goal moved, instead of finishing a field nobody wants
+  if (_dirty)
+  {
+    StartRebuild();
+  }
+
+  if (!_rebuilding)
+    return;
+
+  // std heap functions build a max-heap, so "greater distance" means lower priority
+  constexpr auto queueOrder = [](const QueueEntry &a, const QueueEntry &b) { return a.distance > b.distance; };
+
+  // Time-sliced Dijkstra: expand at most cellBudget cells this call
+  for (std::size_t expanded = 0; expanded < cellBudget && !_queue.empty(); ++expanded)
+  {
+    std::pop_heap(_queue.begin(), _queue.end(), queueOrder);
+    QueueEntry current = _queue.back();
+    _queue.pop_back();
+
+    if (current.distance > _distances[current.cell])
+      continue; // Stale entry, a shorter path to this cell was already found
+
+    std::int32_t column = static_cast<std::int32_t>(current.cell) % _columns;
+    std::int32_t row = static_cast<std::int32_t>(current.cell) / _columns;
+
+    for (const auto &offset : kNeighbours)
+    {
+      std::int32_t neighbourColumn = column + offset.column;
+      std::int32_t neighbourRow = row + offset.row;
+      if (neighbourColumn < 0 || neighbourColumn >= _columns || neighbourRow < 0 || neighbourRow >= _rows)
+        continue;
+
+      auto neighbour = static_cast<std::uint32_t>(neighbourRow * _columns + neighbourColumn);
+      if (_costs[neighbour] == BLOCKED)
+        continue;
+
+      std::uint32_t distance = current.distance + offset.stepCost * _costs[neighbour];
+      if (distance < _distances[neighbour])
+      {
+        _distances[neighbour] = distance;
+        _queue.push_back({distance, neighbour});
+        std::push_heap(_queue.begin(), _queue.end(), queueOrder);
+      }
+    }
+  }
+
+  if (_queue.empty())
+  {
+    // One linear pass over the grid (no searching), cheap even for big arenas
+    BuildDirections();
+    std::swap(_directions, _pendingDirections); // Agents see the new field from now on
+    _rebuilding = false;
+  }
+}
+
+Engine::Vec2 Engine::FlowField::Sample(const Vec2 &worldPosition) const
+{
+  std::int32_t cell = CellIndex(worldPosition);
+  return (cell < 0) ? Vec2{} : _directions[cell];
+}
+
+bool Engine::FlowField::IsRebuilding() const
+{
+  return _rebuilding || _dirty;
+}
+
+std::int32_t Engine::FlowField::CellIndex(const Vec2 &worldPosition) const
+{
+  auto column = static_cast<std::int32_t>(std::floor((worldPosition.x - _origin.x) * _inverseCellSize));
+  auto row = static_cast<std::int32_t>(std::floor((worldPosition.y - _origin.y) * _inverseCellSize));
+  if (column < 0 || column >= _columns || row < 0 || row >= _rows)
+    return -1;
+
+  return row * _columns + column;
+}
+
+void Engine::FlowField::StartRebuild()
+{
+  _dirty = false;
+  _rebuilding = true;
+
+  std::fill(_distances.begin(), _distances.end(), UNREACHED);
+  _queue.clear();
+
+  _distances[_goalCell] = 0;
+  _queue.push_back({0, static_cast<std::uint32_t>(_goalCell)});
+}
+
+void Engine::FlowField::BuildDirections()
+{
+  for (std::int32_t row = 0; row < _rows; ++row)
+  {
+    for (std::int32_t column = 0; column < _columns; ++column)
+    {
+      std::size_t cell = static_cast<std::size_t>(row) * _columns + column;
+      Vec2 direction{};
+
+      // Point at the neighbour closest to the goal. The goal cell and unreachable cells stay {0, 0}.
+      std::uint32_t bestDistance = _distances[cell];
+      for (const auto &offset : kNeighbours)
+      {
+        std::int32_t neighbourColumn = column + offset.column;
+        std::int32_t neighbourRow = row + offset.row;
+        if (neighbourColumn < 0 || neighbourColumn >= _columns || neighbourRow < 0 || neighbourRow >= _rows)
+          continue;
+
+        // Don't cut diagonally past a wall corner
+        if (offset.column != 0 && offset.row != 0 &&
+            (_costs[static_cast<std::size_t>(row) * _columns + neighbourColumn] == BLOCKED ||
+             _costs[static_cast<std::size_t>(neighbourRow) * _columns + column] == BLOCKED))
+          continue;
+
+        std::uint32_t neighbourDistance = _distances[static_cast<std::size_t>(neighbourRow) * _columns + neighbourColumn];
+        if (neighbourDistance < bestDistance)
+        {
+          bestDistance = neighbourDistance;
+          direction = Vec2{static_cast<float>(offset.column), static_cast<float>(offset.row)}.normalized();
+        }
+      }
+
+      _pendingDirections[cell] = direction;
+    }
+  }
+}
@@ -0,0 +1,76 @@
+#include "engine/FrameArena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+Engine::FrameArena::FrameArena(std::size_t capacity)
+    : _buffer(std::make_unique<std::byte[]>(capacity)),
+      _capacity(capacity),
+      _overflow(std::pmr::new_delete_resource())
+{
+}
+
+void Engine::FrameArena::Reset()
+{
+  _peakBytes = std::max(_peakBytes, _offset + _overflowBytes);
+
+  // The last frame didn't fit, so grow the block to the peak (with some headroom) so the next one does
+  if (_overflowBytes > 0)
+  {
+    _capacity = _peakBytes + _peakBytes / 2;
+    _buffer = std::make_unique<std::byte[]>(_capacity);
+    _overflow.release();
+    _overflowBytes = 0;
+  }
+
+  _offset = 0;
+}
+
+std::size_t Engine::FrameArena::GetUsedBytes() const
+{
+  return _offset + _overflowBytes;
+}
+
+std::size_t Engine::FrameArena::GetCapacity() const
+{
+  return _capacity;
+}
+
+std::size_t Engine::FrameArena::GetPeakBytes() const
+{
+  return std::max(_peakBytes, _offset + _overflowBytes);
+}
+
+std::size_t Engine::FrameArena::GetHeapAllocations() const
+{
+  return _heapAllocations;
+}
+
+void *Engine::FrameArena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+  // Align the actual address, not just the offset, so alignments bigger than new[]'s guarantee still work
+  auto base = reinterpret_cast<std::uintptr_t>(_buffer.get());
+  std::uintptr_t aligned = (base + _offset + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+  std::size_t newOffset = (aligned - base) + bytes;
+
+  if (newOffset <= _capacity)
+  {
+    _offset = newOffset;
+    return reinterpret_cast<void *>(aligned);
+  }
+
+  // Out of room: fall back to the heap for the rest of this frame
+  ++_heapAllocations;
+  _overflowBytes += bytes;
+  return _overflow.allocate(bytes, alignment);
+}
+
+void Engine::FrameArena::do_deallocate(void *, std::size_t, std::size_t)
+{
+  // Nothing to do: memory is reclaimed all at once in Reset()
+}
+
+bool Engine::FrameArena::do_is_equal(const std::pmr::memory_resource &other) const noexcept
+{
+  return this == &other;
+}
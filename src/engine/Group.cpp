@@ -0,0 +1,49 @@
+#include "engine/Group.h"
+#include "engine/EntityManager.h"
+
+#include <cassert>
+#include <utility>
+
+Engine::Group::Group(const Signature &signature, std::vector<IComponentArray *> owned)
+    : _signature(signature), _owned(std::move(owned))
+{
+  assert(!_owned.empty() && "A group needs at least one component");
+}
+
+void Engine::Group::Enter(Entity entity)
+{
+  assert(!Contains(entity) && "Entity is already in the group");
+
+  for (auto *array : _owned)
+  {
+    array->SwapElements(array->IndexOf(entity), _size); // Next free member slot
+  }
+  ++_size;
+}
+
+void Engine::Group::Leave(Entity entity)
+{
+  assert(Contains(entity) && "Entity is not in the group");
+
+  --_size;
+  for (auto *array : _owned)
+  {
+    array->SwapElements(array->IndexOf(entity), _size); // Trade places with the last member
+  }
+}
+
+void Engine::Group::Rebuild(const EntityManager &entityManager)
+{
+  // Partition: walk the first array in order, pulling every qualifying entity up to the front.
+  // Members already at the front stay where they are, so a grouped array (e.g. from a snapshot) doesn't move.
+  _size = 0;
+  IComponentArray *first = _owned.front();
+  for (std::size_t i = 0; i < first->Size(); ++i)
+  {
+    Entity entity = first->EntityAt(i);
+    if ((entityManager.GetSignature(entity) & _signature) == _signature)
+    {
+      Enter(entity);
+    }
+  }
+}
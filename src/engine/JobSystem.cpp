@@ -0,0 +1,466 @@
+#include "engine/JobSystem.h"
+
+#include <cassert>
+#include <new>
+
+namespace
+{
+  // The pool a thread belongs to and its index in it (a thread is in at most one pool)
+  thread_local const Engine::JobSystem *tPool = nullptr;
+  thread_local std::size_t tWorkerIndex = 0;
+
+  // Idle workers try this many times to find a job before going to sleep, and so do threads in Wait()
+  // before blocking on the counter. Short: the machine may have fewer cores than threads.
+  constexpr int SPIN_ATTEMPTS = 64;
+
+  // Task frames are recycled by size class (multiples of FRAME_GRANULARITY) instead of going back to
+  // the heap, so starting the same task every frame stops allocating after the first one.
+  constexpr std::size_t FRAME_GRANULARITY = 256;
+  constexpr std::size_t FRAME_SIZE_CLASSES = 16; // Bigger frames use the heap directly
+
+  struct FramePool
+  {
+    std::mutex mutex;
+    std::array<std::vector<void *>, FRAME_SIZE_CLASSES> freeFrames; // Guarded by mutex
+
+    ~FramePool()
+    {
+      for (auto &frames : freeFrames)
+      {
+        for (void *frame : frames)
+          ::operator delete(frame);
+      }
+    }
+  };
+
+  FramePool gFramePool;
+
+  std::size_t FrameSizeClass(std::size_t size)
+  {
+    return (size + FRAME_GRANULARITY - 1) / FRAME_GRANULARITY - 1;
+  }
+
+  // xorshift32, for picking steal victims
+  std::uint32_t NextRandom(std::uint32_t &state)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  }
+}
+
+// =======================================================
+// JobCounter
+
+void Engine::JobCounter::Add(std::size_t count)
+{
+  if (_pending.fetch_add(count, std::memory_order_acq_rel) == 0)
+  {
+    std::lock_guard lock(_mutex);
+    _finished = false;
+  }
+}
+
+void Engine::JobCounter::Decrement()
+{
+  if (_pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    return;
+
+  Continuation *ready = nullptr;
+  {
+    std::lock_guard lock(_mutex);
+
+    // Add() may have started the next batch between our decrement and the lock; then it isn't finished after all
+    if (_pending.load(std::memory_order_acquire) != 0)
+      return;
+
+    _finished = true;
+    ready = std::exchange(_continuations, nullptr);
+    _finishedSignal.notify_all();
+  }
+
+  // The counter may be gone from here on: a resumed task is free to destroy it.
+  // Read next before queuing each task, as the node lives in that task's frame.
+  while (ready)
+  {
+    Continuation *next = ready->next;
+    ready->system->Resume(ready->handle);
+    ready = next;
+  }
+}
+
+void Engine::JobCounter::Block()
+{
+  // Taking the lock also guarantees the last Decrement() has let go of the counter
+  std::unique_lock lock(_mutex);
+  _finishedSignal.wait(lock, [this] { return _finished; });
+}
+
+bool Engine::JobCounter::Suspend(Continuation &waiter)
+{
+  std::lock_guard lock(_mutex);
+  if (_finished)
+    return false;
+
+  waiter.next = _continuations;
+  _continuations = &waiter;
+  return true;
+}
+
+// =======================================================
+// JobTask
+
+void Engine::JobTask::promise_type::FinalAwaiter::await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+{
+  JobCounter *counter = handle.promise().counter; // The promise goes with the frame
+  handle.destroy();
+  JobSystem::FinishTask(*counter);
+}
+
+void *Engine::JobTask::promise_type::operator new(std::size_t size)
+{
+  return JobSystem::AllocateTaskFrame(size);
+}
+
+void Engine::JobTask::promise_type::operator delete(void *pointer, std::size_t size)
+{
+  JobSystem::FreeTaskFrame(pointer, size);
+}
+
+Engine::JobTask &Engine::JobTask::operator=(JobTask &&other) noexcept
+{
+  if (this != &other)
+  {
+    if (_handle)
+      _handle.destroy();
+    _handle = std::exchange(other._handle, {});
+  }
+  return *this;
+}
+
+Engine::JobTask::~JobTask()
+{
+  // Only a task that was never started still owns its frame
+  if (_handle)
+    _handle.destroy();
+}
+
+// =======================================================
+// WorkStealingQueue (Chase-Lev, after Lê et al., "Correct and Efficient Work-Stealing for Weak Memory
+// Models", 2013). Their standalone fences are folded into seq_cst loads and stores: the same
+// instructions on x86, and visible to ThreadSanitizer, which doesn't understand fences.
+
+bool Engine::JobSystem::WorkStealingQueue::IsFull() const
+{
+  std::int64_t bottom = _bottom.load(std::memory_order_relaxed);
+  std::int64_t top = _top.load(std::memory_order_acquire);
+  return bottom - top >= static_cast<std::int64_t>(MAX_JOBS_PER_THREAD);
+}
+
+void Engine::JobSystem::WorkStealingQueue::Push(Job *job)
+{
+  std::int64_t bottom = _bottom.load(std::memory_order_relaxed);
+  _slots[bottom % MAX_JOBS_PER_THREAD].store(job, std::memory_order_relaxed);
+  _bottom.store(bottom + 1, std::memory_order_release); // Publishes the slot to thieves
+}
+
+bool Engine::JobSystem::WorkStealingQueue::Pop(Job &job)
+{
+  // Claim the bottom slot before looking at top, so a thief and we can't both take the last job unnoticed
+  std::int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  _bottom.store(bottom, std::memory_order_seq_cst);
+  std::int64_t top = _top.load(std::memory_order_seq_cst);
+
+  if (top > bottom)
+  {
+    // Empty
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return false;
+  }
+
+  Job popped = *_slots[bottom % MAX_JOBS_PER_THREAD].load(std::memory_order_relaxed);
+  if (top == bottom)
+  {
+    // Last job: race the thieves for it
+    bool won = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    if (!won)
+      return false;
+  }
+  job = popped;
+  return true;
+}
+
+bool Engine::JobSystem::WorkStealingQueue::Steal(Job &job)
+{
+  std::int64_t top = _top.load(std::memory_order_seq_cst);
+  std::int64_t bottom = _bottom.load(std::memory_order_seq_cst);
+  if (top >= bottom)
+    return false;
+
+  // Copy the job out while the slot is still ours to read: once the CAS moves top past it, the owner
+  // may reuse its ring entry at any time. If the CAS fails the copy may be torn, and is thrown away.
+  Job stolen = *_slots[top % MAX_JOBS_PER_THREAD].load(std::memory_order_relaxed);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    return false;
+  job = stolen;
+  return true;
+}
+
+// =======================================================
+// JobSystem
+
+Engine::JobSystem::JobSystem(std::size_t workerCount)
+{
+  assert(!tPool && "This thread already belongs to a JobSystem");
+
+  _workers.reserve(workerCount + 1);
+  for (std::size_t i = 0; i <= workerCount; ++i)
+  {
+    _workers.push_back(std::make_unique<Worker>());
+    _workers.back()->randomState = static_cast<std::uint32_t>(i * 2654435761u) | 1u;
+  }
+
+  // The creating thread is worker 0; the others start now and sleep until there's work
+  tPool = this;
+  tWorkerIndex = 0;
+  for (std::size_t i = 1; i <= workerCount; ++i)
+  {
+    _workers[i]->thread = std::thread(&JobSystem::WorkerLoop, this, i);
+  }
+}
+
+Engine::JobSystem::~JobSystem()
+{
+  _stopping.store(true, std::memory_order_seq_cst);
+  _wakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+  _wakeEpoch.notify_all();
+
+  for (std::size_t i = 1; i < _workers.size(); ++i)
+  {
+    _workers[i]->thread.join();
+  }
+
+  if (tPool == this)
+    tPool = nullptr;
+}
+
+std::size_t Engine::JobSystem::DefaultWorkerCount()
+{
+  unsigned hardwareThreads = std::thread::hardware_concurrency(); // 0 if unknown
+  return hardwareThreads > 2 ? hardwareThreads - 1 : 1;
+}
+
+void Engine::JobSystem::Schedule(Job job)
+{
+  if (job.counter)
+    job.counter->Add(1);
+  Push(job);
+}
+
+void Engine::JobSystem::Start(JobTask task, JobCounter &counter)
+{
+  assert(task._handle && "Task was already started");
+
+  auto handle = std::exchange(task._handle, {});
+  handle.promise().system = this;
+  handle.promise().counter = &counter;
+
+  // The task's own job only resumes it: the counter is decremented when the task returns, not when it first suspends
+  counter.Add(1);
+  Push({.function = &JobSystem::ResumeTask,
+        .data = handle.address(),
+        .phase = AllocationTracker::GetPhase()});
+}
+
+void Engine::JobSystem::Wait(JobCounter &counter)
+{
+  Worker *self = GetCurrentWorker();
+
+  int idleAttempts = 0;
+  while (!counter.IsDone() && idleAttempts < SPIN_ATTEMPTS)
+  {
+    Job job;
+    if (FindJob(self, job))
+    {
+      Execute(job);
+      idleAttempts = 0;
+    }
+    else
+    {
+      ++idleAttempts;
+      std::this_thread::yield();
+    }
+  }
+
+  // Nothing left to help with: what remains is running on other threads
+  counter.Block();
+}
+
+void Engine::JobSystem::Push(const Job &job)
+{
+  if (Worker *self = GetCurrentWorker())
+  {
+    if (self->queue.IsFull())
+    {
+      // Too much in flight already: run it now instead of waiting for room
+      Execute(job);
+      return;
+    }
+
+    // The job waits in this thread's ring; its deque only holds a pointer
+    Job &slot = self->jobs[self->nextJob++ % self->jobs.size()];
+    slot = job;
+    self->queue.Push(&slot);
+  }
+  else
+  {
+    std::lock_guard lock(_externalMutex);
+    _externalJobs.push_back(job);
+    _hasExternalJobs.store(true, std::memory_order_release);
+  }
+
+  WakeOne();
+}
+
+void Engine::JobSystem::Resume(std::coroutine_handle<> handle)
+{
+  Push({.function = &JobSystem::ResumeTask,
+        .data = handle.address(),
+        .phase = AllocationTracker::GetPhase()});
+}
+
+void Engine::JobSystem::ResumeTask(void *address, std::size_t, std::size_t)
+{
+  std::coroutine_handle<>::from_address(address).resume();
+}
+
+void *Engine::JobSystem::AllocateTaskFrame(std::size_t size)
+{
+  std::size_t sizeClass = FrameSizeClass(size);
+  if (sizeClass >= FRAME_SIZE_CLASSES)
+    return ::operator new(size);
+
+  {
+    std::lock_guard lock(gFramePool.mutex);
+    auto &freeFrames = gFramePool.freeFrames[sizeClass];
+    if (!freeFrames.empty())
+    {
+      void *frame = freeFrames.back();
+      freeFrames.pop_back();
+      return frame;
+    }
+  }
+  return ::operator new((sizeClass + 1) * FRAME_GRANULARITY);
+}
+
+void Engine::JobSystem::FreeTaskFrame(void *pointer, std::size_t size)
+{
+  std::size_t sizeClass = FrameSizeClass(size);
+  if (sizeClass >= FRAME_SIZE_CLASSES)
+  {
+    ::operator delete(pointer);
+    return;
+  }
+
+  std::lock_guard lock(gFramePool.mutex);
+  gFramePool.freeFrames[sizeClass].push_back(pointer);
+}
+
+Engine::JobSystem::Worker *Engine::JobSystem::GetCurrentWorker() const
+{
+  return tPool == this ? _workers[tWorkerIndex].get() : nullptr;
+}
+
+bool Engine::JobSystem::FindJob(Worker *self, Job &job)
+{
+  // 1. Our own newest job
+  if (self)
+  {
+    if (self->queue.Pop(job))
+      return true;
+  }
+
+  // 2. Anything scheduled from outside the pool
+  if (_hasExternalJobs.load(std::memory_order_acquire))
+  {
+    std::lock_guard lock(_externalMutex);
+    if (!_externalJobs.empty())
+    {
+      job = _externalJobs.back();
+      _externalJobs.pop_back();
+      _hasExternalJobs.store(!_externalJobs.empty(), std::memory_order_release);
+      return true;
+    }
+  }
+
+  // 3. The oldest job of another thread, starting from a random one so thieves spread out
+  std::size_t threadCount = _workers.size();
+  std::uint32_t randomState = self ? self->randomState : 0x9E3779B9u;
+  std::size_t first = NextRandom(randomState) % threadCount;
+  if (self)
+    self->randomState = randomState;
+
+  for (std::size_t i = 0; i < threadCount; ++i)
+  {
+    Worker &victim = *_workers[(first + i) % threadCount];
+    if (&victim == self)
+      continue;
+
+    if (victim.queue.Steal(job))
+      return true;
+  }
+  return false;
+}
+
+void Engine::JobSystem::Execute(const Job &job)
+{
+  AllocationTracker::ScopedPhase phase(job.phase);
+  job.function(job.data, job.begin, job.end);
+  if (job.counter)
+    job.counter->Decrement();
+}
+
+void Engine::JobSystem::WorkerLoop(std::size_t index)
+{
+  tPool = this;
+  tWorkerIndex = index;
+  Worker *self = _workers[index].get();
+
+  int idleAttempts = 0;
+  while (true)
+  {
+    // Read the epoch before looking, so a job scheduled after a failed look still wakes us
+    std::uint32_t epoch = _wakeEpoch.load(std::memory_order_seq_cst);
+
+    Job job;
+    if (FindJob(self, job))
+    {
+      Execute(job);
+      idleAttempts = 0;
+      continue;
+    }
+
+    if (_stopping.load(std::memory_order_acquire))
+      return;
+
+    if (++idleAttempts < SPIN_ATTEMPTS)
+    {
+      std::this_thread::yield();
+      continue;
+    }
+
+    _sleepers.fetch_add(1, std::memory_order_seq_cst);
+    _wakeEpoch.wait(epoch, std::memory_order_seq_cst);
+    _sleepers.fetch_sub(1, std::memory_order_seq_cst);
+    idleAttempts = 0;
+  }
+}
+
+void Engine::JobSystem::WakeOne()
+{
+  _wakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+  if (_sleepers.load(std::memory_order_seq_cst) > 0)
+    _wakeEpoch.notify_one();
+}
@@ -0,0 +1,60 @@
+#include "engine/RadixSort.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+void Engine::RadixSort(std::span<std::uint64_t> keys, std::span<std::uint64_t> scratch, unsigned firstByte)
+{
+  assert(scratch.size() >= keys.size() && "RadixSort scratch buffer is too small");
+  assert(firstByte <= 8 && "RadixSort only has 8 bytes to sort on");
+
+  const std::size_t count = keys.size();
+  if (count < 2 || firstByte >= 8)
+    return;
+
+  // 1. One histogram per byte, all from a single read of the keys
+  std::array<std::array<std::uint32_t, 256>, 8> histograms{};
+  for (std::uint64_t key : keys)
+  {
+    for (unsigned byte = firstByte; byte < 8; ++byte)
+    {
+      ++histograms[byte][(key >> (byte * 8)) & 0xFF];
+    }
+  }
+
+  // 2. One stable counting-sort pass per byte, ping-ponging between the two buffers
+  std::uint64_t *source = keys.data();
+  std::uint64_t *destination = scratch.data();
+
+  for (unsigned byte = firstByte; byte < 8; ++byte)
+  {
+    auto &histogram = histograms[byte];
+
+    // Every key has the same value in this byte: the pass wouldn't change anything
+    if (histogram[(source[0] >> (byte * 8)) & 0xFF] == count)
+      continue;
+
+    // Counts -> starting offsets
+    std::uint32_t offset = 0;
+    for (auto &bucket : histogram)
+    {
+      std::uint32_t bucketCount = bucket;
+      bucket = offset;
+      offset += bucketCount;
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      std::uint64_t key = source[i];
+      destination[histogram[(key >> (byte * 8)) & 0xFF]++] = key;
+    }
+    std::swap(source, destination);
+  }
+
+  // An odd number of passes leaves the result in scratch
+  if (source != keys.data())
+  {
+    std::copy_n(source, count, keys.data());
+  }
+}
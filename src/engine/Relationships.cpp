@@ -0,0 +1,77 @@
+#include "engine/Relationships.h"
+
+#include <cassert>
+
+Engine::Relationships::Relationships()
+{
+  _links.fill(Links{});
+}
+
+void Engine::Relationships::SetParent(Entity child, Entity parent)
+{
+  assert(child < MAX_ENTITIES && parent < MAX_ENTITIES && "Entity is out of range.");
+  assert(child != parent && "An entity can't be its own parent");
+
+  RemoveParent(child);
+
+  // Push to the front of the parent's child list
+  auto &links = _links[child];
+  auto &parentLinks = _links[parent];
+  links.parent = parent;
+  links.nextSibling = parentLinks.firstChild;
+  if (parentLinks.firstChild != NULL_ENTITY)
+  {
+    _links[parentLinks.firstChild].previousSibling = child;
+  }
+  parentLinks.firstChild = child;
+}
+
+void Engine::Relationships::RemoveParent(Entity child)
+{
+  assert(child < MAX_ENTITIES && "Entity is out of range.");
+
+  auto &links = _links[child];
+  if (links.parent == NULL_ENTITY)
+    return;
+
+  // Unlink from the sibling list
+  if (links.previousSibling != NULL_ENTITY)
+    _links[links.previousSibling].nextSibling = links.nextSibling;
+  else
+    _links[links.parent].firstChild = links.nextSibling;
+
+  if (links.nextSibling != NULL_ENTITY)
+    _links[links.nextSibling].previousSibling = links.previousSibling;
+
+  links.parent = NULL_ENTITY;
+  links.previousSibling = NULL_ENTITY;
+  links.nextSibling = NULL_ENTITY;
+}
+
+void Engine::Relationships::EntityDestroyed(Entity entity)
+{
+  assert(_links[entity].firstChild == NULL_ENTITY && "Destroy (or detach) the children before their parent");
+  RemoveParent(entity);
+}
+
+// Layout: Links[MAX_ENTITIES]
+void Engine::Relationships::Serialize(SnapshotWriter &writer) const
+{
+  writer.WriteBytes(_links.data(), sizeof(_links));
+}
+
+bool Engine::Relationships::Deserialize(SnapshotReader &reader)
+{
+  if (!reader.ReadBytes(_links.data(), sizeof(_links)))
+    return false;
+
+  auto isValid = [](Entity entity)
+  { return entity < MAX_ENTITIES || entity == NULL_ENTITY; };
+
+  for (const auto &links : _links)
+  {
+    if (!isValid(links.parent) || !isValid(links.firstChild) || !isValid(links.previousSibling) || !isValid(links.nextSibling))
+      return false;
+  }
+  return true;
+}
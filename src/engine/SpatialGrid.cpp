@@ -0,0 +1,95 @@
+#include "engine/SpatialGrid.h"
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+Engine::SpatialGrid::SpatialGrid(float cellSize)
+    : _cellSize(cellSize)
+{
+  assert(cellSize > 0.0f && "SpatialGrid cell size must be positive");
+}
+
+void Engine::SpatialGrid::Build(std::span<const float> xs, std::span<const float> ys)
+{
+  assert(xs.size() == ys.size() && "SpatialGrid needs one y for every x");
+
+  const std::size_t count = xs.size();
+  _sortedX.resize(count);
+  _sortedY.resize(count);
+  _sortedIndex.resize(count);
+  _pointCell.resize(count);
+
+  if (count == 0)
+  {
+    _columns = 0;
+    _rows = 0;
+    return;
+  }
+
+  // 1. Bounds of this frame's points
+  float minX = std::numeric_limits<float>::max();
+  float minY = std::numeric_limits<float>::max();
+  float maxX = std::numeric_limits<float>::lowest();
+  float maxY = std::numeric_limits<float>::lowest();
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    minX = std::min(minX, xs[i]);
+    maxX = std::max(maxX, xs[i]);
+    minY = std::min(minY, ys[i]);
+    maxY = std::max(maxY, ys[i]);
+  }
+
+  // Cells can only get bigger than requested (still correct for radius queries), never smaller
+  float extent = std::max(maxX - minX, maxY - minY);
+  float cellSize = std::max(_cellSize, extent / (MAX_CELLS_PER_AXIS - 1));
+
+  _inverseCellSize = 1.0f / cellSize;
+  _originX = minX;
+  _originY = minY;
+  _columns = static_cast<std::int32_t>((maxX - minX) * _inverseCellSize) + 1;
+  _rows = static_cast<std::int32_t>((maxY - minY) * _inverseCellSize) + 1;
+
+  // 2. Count points per cell (stored shifted by one so the prefix sum below gives start offsets)
+  const std::size_t cellCount = static_cast<std::size_t>(_columns) * _rows;
+  _cellStart.assign(cellCount + 1, 0);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    auto cell = static_cast<std::uint32_t>(CellY(ys[i]) * _columns + CellX(xs[i]));
+    _pointCell[i] = cell;
+    ++_cellStart[cell + 1];
+  }
+
+  // 3. Prefix sum: _cellStart[cell] = first sorted slot for that cell
+  for (std::size_t cell = 0; cell < cellCount; ++cell)
+  {
+    _cellStart[cell + 1] += _cellStart[cell];
+  }
+
+  // 4. Scatter points into their cell's slots. Walking backwards with a decrementing cursor keeps the
+  //    original order inside each cell and reuses _cellStart[cell + 1] as the write position.
+  for (std::size_t i = count; i-- > 0;)
+  {
+    std::uint32_t slot = --_cellStart[_pointCell[i] + 1];
+    _sortedX[slot] = xs[i];
+    _sortedY[slot] = ys[i];
+    _sortedIndex[slot] = static_cast<std::uint32_t>(i);
+  }
+
+  // 5. Every _cellStart[cell + 1] now holds the start of `cell`, so shift the table down by one
+  for (std::size_t cell = 0; cell < cellCount; ++cell)
+  {
+    _cellStart[cell] = _cellStart[cell + 1];
+  }
+  _cellStart[cellCount] = static_cast<std::uint32_t>(count);
+}
+
+std::int32_t Engine::SpatialGrid::CellX(float x) const
+{
+  return std::clamp(static_cast<std::int32_t>((x - _originX) * _inverseCellSize), 0, _columns - 1);
+}
+
+std::int32_t Engine::SpatialGrid::CellY(float y) const
+{
+  return std::clamp(static_cast<std::int32_t>((y - _originY) * _inverseCellSize), 0, _rows - 1);
+}
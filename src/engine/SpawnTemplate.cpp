@@ -0,0 +1,43 @@
+#include "engine/SpawnTemplate.h"
+
+#include <cassert>
+#include <cstring>
+
+void Engine::SpawnTemplate::Set(ComponentType type, IComponentArray *array, const void *component,
+                                std::size_t size, std::size_t alignment)
+{
+  assert(type < MAX_COMPONENTS && "Component type out of range");
+
+  if (_signature.test(type))
+  {
+    for (const auto &entry : _entries)
+    {
+      if (entry.type == type)
+      {
+        std::memcpy(_image.data() + entry.offset, component, size);
+        return;
+      }
+    }
+  }
+
+  // Append at the next aligned offset so the image could be read in place if needed
+  std::size_t offset = (_image.size() + alignment - 1) / alignment * alignment;
+  _image.resize(offset + size);
+  std::memcpy(_image.data() + offset, component, size);
+
+  _entries.push_back({type, array, static_cast<std::uint32_t>(offset), static_cast<std::uint32_t>(size)});
+  _signature.set(type);
+}
+
+const std::byte *Engine::SpawnTemplate::Find(ComponentType type) const
+{
+  if (!_signature.test(type))
+    return nullptr;
+
+  for (const auto &entry : _entries)
+  {
+    if (entry.type == type)
+      return GetBytes(entry);
+  }
+  return nullptr;
+}
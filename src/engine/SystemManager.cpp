@@ -1,5 +1,7 @@
 #include "engine/SystemManager.h"
 
+#include <algorithm>
+
 void Engine::SystemManager::EntityDestroyed(Entity entity)
 {
   for (const auto &[type, system] : _systems)
@@ -33,3 +35,24 @@ void Engine::SystemManager::EntitySignatureChanged(Entity entity, const Signatur
     }
   }
 }
+
+void Engine::SystemManager::Clear()
+{
+  for (const auto &[type, system] : _systems)
+  {
+    system->_entities.clear();
+  }
+}
+
+void Engine::SystemManager::CollectTelemetry(std::vector<Telemetry::SystemStats> &systems) const
+{
+  systems.clear();
+  for (const auto &[type, system] : _systems)
+  {
+    systems.push_back({_names.at(type), system->_entities.size()});
+  }
+
+  // Hash map order is arbitrary: sort so an overlay doesn't shuffle between runs
+  std::sort(systems.begin(), systems.end(), [](const Telemetry::SystemStats &a, const Telemetry::SystemStats &b)
+            { return a.name < b.name; });
+}
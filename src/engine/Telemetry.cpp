@@ -0,0 +1,31 @@
+#include "engine/Telemetry.h"
+
+#include <cstdlib>
+#include <memory>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+std::string Engine::ReadableTypeName(const std::type_info &type)
+{
+  std::string name = type.name();
+
+#if defined(__GNUG__)
+  // GCC and Clang return mangled names ("N10Components9TransformE")
+  int status = 0;
+  std::unique_ptr<char, decltype(&std::free)> demangled(abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status), &std::free);
+  if (status == 0 && demangled)
+  {
+    name = demangled.get();
+  }
+#endif
+
+  // MSVC prefixes "struct " / "class ", and everyone keeps the namespaces: drop both
+  auto lastSeparator = name.find_last_of(": ");
+  if (lastSeparator != std::string::npos)
+  {
+    name.erase(0, lastSeparator + 1);
+  }
+  return name;
+}
@@ -1,18 +1,34 @@
 #include "engine/TextureManager.h"
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <sstream>
 
-Engine::TextureManager &Engine::TextureManager::GetInstance()
+Engine::TextureManager::~TextureManager()
 {
-  static Engine::TextureManager instance;
-  return instance;
+  Shutdown();
 }
 
-Engine::TextureManager::~TextureManager()
+void Engine::TextureManager::Shutdown()
 {
+  // No new reloads, and none still decoding, before anything they'd touch goes away
+  _watcher.Stop();
+  if (_jobs)
+  {
+    _jobs->Wait(_reloadsDecoding);
+  }
+
+  std::lock_guard lock(_pendingMutex);
+  for (auto &pending : _pending)
+  {
+    SDL_DestroySurface(pending.surface);
+  }
+  _pending.clear();
+  _hasPending = false;
   Clear();
 }
 
-void Engine::TextureManager::Init(SDL_Renderer *renderer)
+void Engine::TextureManager::Init(SDL_Renderer *renderer, JobSystem *jobs)
 {
   if (!renderer)
   {
@@ -20,14 +36,103 @@ void Engine::TextureManager::Init(SDL_Renderer *renderer)
     return;
   }
   _renderer = renderer;
+  _jobs = jobs;
 }
 
-void Engine::TextureManager::LoadAllTextures()
+bool Engine::TextureManager::LoadManifest(const std::string &manifestPath)
 {
-  for (const auto &[id, filepath] : TextureAssets)
+  if (!_renderer)
+  {
+    std::cerr << "TextureManager::LoadManifest - TextureManager not initialized (call Init first)\n";
+    return false;
+  }
+
+  std::ifstream manifest(manifestPath);
+  if (!manifest)
+  {
+    std::cerr << "TextureManager::LoadManifest - Failed to open '" << manifestPath << "'\n";
+    return false;
+  }
+
+  // Image paths are relative to the manifest, so the assets folder can live anywhere
+  std::filesystem::path directory = std::filesystem::path(manifestPath).parent_path();
+
+  // Read the whole manifest first, so every image can be decoded at once
+  struct Entry
+  {
+    TextureID id;
+    std::string path;
+    SDL_Surface *surface = nullptr;
+    std::string error; // SDL errors are per thread, so a failed decode keeps its own
+  };
+  std::vector<Entry> entries;
+
+  std::string line;
+  int lineNumber = 0;
+  while (std::getline(manifest, line))
+  {
+    ++lineNumber;
+    std::istringstream fields(line);
+    std::string name, path;
+    if (!(fields >> name) || name.starts_with('#'))
+      continue; // Blank line or comment
+
+    auto id = TextureNames.find(name);
+    if (id == TextureNames.end() || !(fields >> path))
+    {
+      std::cerr << "TextureManager::LoadManifest - " << manifestPath << ":" << lineNumber
+                << ": expected '<texture name> <path>', got '" << line << "'\n";
+      continue;
+    }
+
+    if (_textures.find(id->second) == _textures.end())
+    {
+      entries.push_back({id->second, (directory / path).lexically_normal().generic_string(), nullptr, {}});
+    }
+  }
+
+  // Decoding is the slow part, and each image is independent: one job per image
+  auto decode = [&entries](std::size_t begin, std::size_t end)
+  {
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      entries[i].surface = IMG_Load(entries[i].path.c_str());
+      if (!entries[i].surface)
+      {
+        entries[i].error = SDL_GetError();
+      }
+    }
+  };
+  if (_jobs)
+  {
+    JobCounter decoded;
+    _jobs->ParallelFor(decoded, entries.size(), 1, decode);
+    _jobs->Wait(decoded);
+  }
+  else
+  {
+    decode(0, entries.size());
+  }
+
+  // Uploading has to happen here, on the renderer's thread
+  for (const auto &entry : entries)
   {
-    Load(id, filepath);
+    if (!entry.surface)
+    {
+      std::cerr << "TextureManager::LoadManifest - Failed to load image '" << entry.path
+                << "': " << entry.error << "\n";
+      continue;
+    }
+
+    // Listed twice: the first one wins, as with Load()
+    if (_textures.find(entry.id) != _textures.end())
+    {
+      SDL_DestroySurface(entry.surface);
+      continue;
+    }
+    AddTexture(entry.id, entry.surface, entry.path);
   }
+  return true;
 }
 
 bool Engine::TextureManager::Load(TextureID id, const std::string &filepath)
@@ -54,23 +159,37 @@ bool Engine::TextureManager::Load(TextureID id, const std::string &filepath)
     return false;
   }
 
+  return AddTexture(id, surface, filepath);
+}
+
+bool Engine::TextureManager::AddTexture(TextureID id, SDL_Surface *surface, const std::string &filepath)
+{
   // Convert surface to GPU texture
-  SDL_Texture *texture = SDL_CreateTextureFromSurface(_renderer, surface);
+  SDL_Texture *texture = CreateTexture(surface, filepath);
   SDL_DestroySurface(surface); // Surface no longer needed
 
+  if (!texture)
+    return false;
+
+  // Store texture for future retrieval, and remember where it came from for hot reload
+  _textures[id] = texture;
+  _paths[id] = std::filesystem::path(filepath).lexically_normal().generic_string();
+  return true;
+}
+
+SDL_Texture *Engine::TextureManager::CreateTexture(SDL_Surface *surface, const std::string &filepath) const
+{
+  SDL_Texture *texture = SDL_CreateTextureFromSurface(_renderer, surface);
   if (!texture)
   {
-    std::cerr << "TextureManager::Load - Failed to create texture from '" << filepath
+    std::cerr << "TextureManager - Failed to create texture from '" << filepath
               << "': " << SDL_GetError() << "\n";
-    return false;
+    return nullptr;
   }
 
   // Set default scale mode for pixel art (can be overridden per-sprite if needed)
   SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
-
-  // Store texture for future retrieval
-  _textures[id] = texture;
-  return true;
+  return texture;
 }
 
 SDL_Texture *Engine::TextureManager::Get(TextureID id) const
@@ -100,3 +219,90 @@ void Engine::TextureManager::Clear()
   }
   _textures.clear();
 }
+
+void Engine::TextureManager::EnableHotReload()
+{
+  // Load everything before this: the watcher thread reads _paths without a lock
+  for (const auto &[id, path] : _paths)
+  {
+    _watcher.Watch(path);
+  }
+  _watcher.Start([this](const std::string &path)
+                 { OnFileChanged(path); });
+}
+
+void Engine::TextureManager::OnFileChanged(const std::string &path)
+{
+  for (const auto &[id, texturePath] : _paths)
+  {
+    if (texturePath != path)
+      continue;
+
+    // Decode off the main thread: only the GPU upload has to happen there.
+    // Without a JobSystem, the watcher thread decodes it itself.
+    if (_jobs)
+    {
+      _jobs->Schedule({.function = &TextureManager::DecodeReload,
+                       .data = this,
+                       .begin = static_cast<std::size_t>(id),
+                       .counter = &_reloadsDecoding});
+    }
+    else
+    {
+      DecodeReload(this, static_cast<std::size_t>(id), 0);
+    }
+  }
+}
+
+void Engine::TextureManager::DecodeReload(void *self, std::size_t id, std::size_t)
+{
+  auto &manager = *static_cast<TextureManager *>(self);
+  auto textureId = static_cast<TextureID>(id);
+  const std::string &path = manager._paths.at(textureId); // Read-only once hot reload is on
+
+  // A half-written file just fails to decode; the final write triggers another event.
+  SDL_Surface *surface = IMG_Load(path.c_str());
+  if (!surface)
+  {
+    std::cerr << "TextureManager - Hot reload of '" << path << "' failed: " << SDL_GetError() << "\n";
+    return;
+  }
+
+  std::lock_guard lock(manager._pendingMutex);
+  manager._pending.push_back({textureId, surface});
+  manager._hasPending = true;
+}
+
+std::vector<TextureID> Engine::TextureManager::ApplyPendingReloads()
+{
+  std::vector<TextureID> reloaded;
+  if (!_hasPending.load(std::memory_order_acquire))
+    return reloaded;
+
+  std::vector<PendingReload> pending;
+  {
+    std::lock_guard lock(_pendingMutex);
+    pending.swap(_pending);
+    _hasPending = false;
+  }
+
+  for (const auto &[id, surface] : pending)
+  {
+    SDL_Texture *texture = CreateTexture(surface, _paths[id]);
+    SDL_DestroySurface(surface);
+    if (!texture)
+      continue;
+
+    // Swap under the same ID: the old texture is only destroyed after the new one exists
+    SDL_Texture *&slot = _textures[id];
+    if (slot)
+    {
+      SDL_DestroyTexture(slot);
+    }
+    slot = texture;
+
+    reloaded.push_back(id);
+    std::cout << "Reloaded texture '" << _paths[id] << "'\n";
+  }
+  return reloaded;
+}
@@ -0,0 +1,161 @@
+#include "engine/Tilemap.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+Engine::Tilemap::Tilemap(float tileSize, std::int32_t columns, std::int32_t rows)
+    : _tileSize(tileSize),
+      _columns(columns),
+      _rows(rows),
+      _chunkColumns((columns + CHUNK_TILES - 1) / CHUNK_TILES),
+      _chunkRows((rows + CHUNK_TILES - 1) / CHUNK_TILES),
+      _tiles(static_cast<std::size_t>(columns) * rows, EMPTY),
+      _chunks(static_cast<std::size_t>(_chunkColumns) * _chunkRows)
+{
+  assert(tileSize > 0.0f && columns > 0 && rows > 0 && "Tilemap needs a positive tile size and dimensions");
+}
+
+Engine::Tilemap::~Tilemap()
+{
+  Release();
+}
+
+void Engine::Tilemap::Init(SDL_Renderer *renderer, TextureManager *textureManager, TextureID tileset)
+{
+  _renderer = renderer;
+  _textureManager = textureManager;
+  _tileset = tileset;
+
+  SDL_Texture *texture = _textureManager->Get(tileset);
+  if (!texture)
+  {
+    std::cerr << "Tilemap::Init - Tileset texture is not loaded\n";
+    return;
+  }
+
+  float width = 0.0f;
+  float height = 0.0f;
+  SDL_GetTextureSize(texture, &width, &height);
+  _tilesetColumns = std::max(1, static_cast<std::int32_t>(width / _tileSize));
+
+  InvalidateChunks();
+}
+
+void Engine::Tilemap::SetTile(std::int32_t column, std::int32_t row, std::uint16_t tile)
+{
+  assert(column >= 0 && column < _columns && row >= 0 && row < _rows && "Tile out of range");
+
+  auto &current = _tiles[static_cast<std::size_t>(row) * _columns + column];
+  if (current == tile)
+    return;
+
+  current = tile;
+  _chunks[static_cast<std::size_t>(row / CHUNK_TILES) * _chunkColumns + column / CHUNK_TILES].dirty = true;
+}
+
+std::uint16_t Engine::Tilemap::GetTile(std::int32_t column, std::int32_t row) const
+{
+  assert(column >= 0 && column < _columns && row >= 0 && row < _rows && "Tile out of range");
+  return _tiles[static_cast<std::size_t>(row) * _columns + column];
+}
+
+void Engine::Tilemap::Draw(const Camera &camera)
+{
+  if (!_renderer || _tilesetColumns == 0)
+    return;
+
+  const SDL_FRect view = camera.GetWorldView();
+  const float zoom = camera.GetZoom();
+
+  // Chunks overlapping the view
+  const float chunkSize = _tileSize * CHUNK_TILES;
+  const auto firstColumn = std::max(0, static_cast<std::int32_t>(std::floor(view.x / chunkSize)));
+  const auto firstRow = std::max(0, static_cast<std::int32_t>(std::floor(view.y / chunkSize)));
+  const auto lastColumn = std::min(_chunkColumns - 1, static_cast<std::int32_t>(std::floor((view.x + view.w) / chunkSize)));
+  const auto lastRow = std::min(_chunkRows - 1, static_cast<std::int32_t>(std::floor((view.y + view.h) / chunkSize)));
+
+  for (std::int32_t chunkRow = firstRow; chunkRow <= lastRow; ++chunkRow)
+  {
+    for (std::int32_t chunkColumn = firstColumn; chunkColumn <= lastColumn; ++chunkColumn)
+    {
+      auto &chunk = _chunks[static_cast<std::size_t>(chunkRow) * _chunkColumns + chunkColumn];
+      if (chunk.dirty && !RebuildChunk(chunkColumn, chunkRow))
+        continue;
+
+      Vec2 topLeft = camera.WorldToScreen({chunkColumn * chunkSize, chunkRow * chunkSize});
+      SDL_FRect destination{topLeft.x, topLeft.y, chunkSize * zoom, chunkSize * zoom};
+      SDL_RenderTexture(_renderer, chunk.texture, nullptr, &destination);
+    }
+  }
+}
+
+bool Engine::Tilemap::RebuildChunk(std::int32_t chunkColumn, std::int32_t chunkRow)
+{
+  auto &chunk = _chunks[static_cast<std::size_t>(chunkRow) * _chunkColumns + chunkColumn];
+  const int chunkPixels = static_cast<int>(std::ceil(_tileSize * CHUNK_TILES));
+
+  if (!chunk.texture)
+  {
+    chunk.texture = SDL_CreateTexture(_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, chunkPixels, chunkPixels);
+    if (!chunk.texture)
+    {
+      std::cerr << "Tilemap::RebuildChunk - Failed to create chunk texture: " << SDL_GetError() << "\n";
+      return false;
+    }
+    SDL_SetTextureBlendMode(chunk.texture, SDL_BLENDMODE_BLEND);
+  }
+
+  SDL_Texture *tileset = _textureManager->Get(_tileset);
+  SDL_Texture *previousTarget = SDL_GetRenderTarget(_renderer);
+  SDL_SetRenderTarget(_renderer, chunk.texture);
+
+  // Start from transparent so EMPTY tiles show whatever is behind the map
+  SDL_SetRenderDrawColor(_renderer, 0, 0, 0, 0);
+  SDL_RenderClear(_renderer);
+
+  const std::int32_t firstColumn = chunkColumn * CHUNK_TILES;
+  const std::int32_t firstRow = chunkRow * CHUNK_TILES;
+  const std::int32_t endColumn = std::min(firstColumn + CHUNK_TILES, _columns);
+  const std::int32_t endRow = std::min(firstRow + CHUNK_TILES, _rows);
+
+  for (std::int32_t row = firstRow; row < endRow; ++row)
+  {
+    for (std::int32_t column = firstColumn; column < endColumn; ++column)
+    {
+      std::uint16_t tile = _tiles[static_cast<std::size_t>(row) * _columns + column];
+      if (tile == EMPTY)
+        continue;
+
+      SDL_FRect source{(tile % _tilesetColumns) * _tileSize, (tile / _tilesetColumns) * _tileSize, _tileSize, _tileSize};
+      SDL_FRect destination{(column - firstColumn) * _tileSize, (row - firstRow) * _tileSize, _tileSize, _tileSize};
+      SDL_RenderTexture(_renderer, tileset, &source, &destination);
+    }
+  }
+
+  SDL_SetRenderTarget(_renderer, previousTarget);
+  chunk.dirty = false;
+  return true;
+}
+
+void Engine::Tilemap::InvalidateChunks()
+{
+  for (auto &chunk : _chunks)
+  {
+    chunk.dirty = true;
+  }
+}
+
+void Engine::Tilemap::Release()
+{
+  for (auto &chunk : _chunks)
+  {
+    if (chunk.texture)
+    {
+      SDL_DestroyTexture(chunk.texture);
+      chunk.texture = nullptr;
+    }
+    chunk.dirty = true;
+  }
+}
@@ -0,0 +1,373 @@
+#include "engine/Vec2Batch.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define VEC2_BATCH_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define VEC2_BATCH_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define VEC2_BATCH_NEON 1
+#endif
+
+namespace
+{
+  constexpr float kPi = 3.14159265358979f;
+  constexpr float kHalfPi = 1.57079632679490f;
+  constexpr float kInverseTwoPi = 0.159154943091895f;
+
+  // 2π split in two, so reducing large angles doesn't lose the low bits (Cody-Waite)
+  constexpr float kTwoPiHigh = 6.28125f;
+  constexpr float kTwoPiLow = 0.00193530717958647f;
+
+  // Vec2::normalize() refuses lengths <= epsilon; compare squared lengths against epsilon² instead
+  constexpr float kMinLengthSquared = std::numeric_limits<float>::epsilon() * std::numeric_limits<float>::epsilon();
+
+  // Repulsion ignores points closer than this (squared), which also skips the point itself
+  constexpr float kMinRepulsionDistanceSquared = 1e-6f;
+
+  /**
+   * Lanes - one set of float operations per backend
+   *
+   * Every algorithm below is written once as a template over these. The SIMD version handles
+   * full registers and ScalarLanes handles the leftovers, with the same formulas.
+   */
+  struct ScalarLanes
+  {
+    using Vector = float;
+    using Mask = bool;
+    static constexpr std::size_t WIDTH = 1;
+
+    static Vector Load(const float *p) { return *p; }
+    static void Store(float *p, Vector v) { *p = v; }
+    static Vector Set(float v) { return v; }
+    static Vector Add(Vector a, Vector b) { return a + b; }
+    static Vector Sub(Vector a, Vector b) { return a - b; }
+    static Vector Mul(Vector a, Vector b) { return a * b; }
+    static Vector Div(Vector a, Vector b) { return a / b; }
+    static Vector Sqrt(Vector v) { return std::sqrt(v); }
+    static Vector Min(Vector a, Vector b) { return std::min(a, b); }
+    static Vector Max(Vector a, Vector b) { return std::max(a, b); }
+    static Vector Abs(Vector v) { return std::fabs(v); }
+    static Vector Round(Vector v) { return std::nearbyint(v); }
+    static Mask Greater(Vector a, Vector b) { return a > b; }
+    static Mask Less(Vector a, Vector b) { return a < b; }
+    static Mask And(Mask a, Mask b) { return a && b; }
+    static Vector Select(Mask m, Vector a, Vector b) { return m ? a : b; }
+    static float Sum(Vector v) { return v; }
+  };
+
+#if defined(VEC2_BATCH_AVX2)
+  struct SimdLanes
+  {
+    using Vector = __m256;
+    using Mask = __m256;
+    static constexpr std::size_t WIDTH = 8;
+
+    static Vector Load(const float *p) { return _mm256_loadu_ps(p); }
+    static void Store(float *p, Vector v) { _mm256_storeu_ps(p, v); }
+    static Vector Set(float v) { return _mm256_set1_ps(v); }
+    static Vector Add(Vector a, Vector b) { return _mm256_add_ps(a, b); }
+    static Vector Sub(Vector a, Vector b) { return _mm256_sub_ps(a, b); }
+    static Vector Mul(Vector a, Vector b) { return _mm256_mul_ps(a, b); }
+    static Vector Div(Vector a, Vector b) { return _mm256_div_ps(a, b); }
+    static Vector Sqrt(Vector v) { return _mm256_sqrt_ps(v); }
+    static Vector Min(Vector a, Vector b) { return _mm256_min_ps(a, b); }
+    static Vector Max(Vector a, Vector b) { return _mm256_max_ps(a, b); }
+    static Vector Abs(Vector v) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), v); }
+    static Vector Round(Vector v) { return _mm256_round_ps(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+    static Mask Greater(Vector a, Vector b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static Mask Less(Vector a, Vector b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static Mask And(Mask a, Mask b) { return _mm256_and_ps(a, b); }
+    static Vector Select(Mask m, Vector a, Vector b) { return _mm256_blendv_ps(b, a, m); }
+    static float Sum(Vector v)
+    {
+      __m128 halves = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+      alignas(16) float lanes[4];
+      _mm_store_ps(lanes, halves);
+      return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+  };
+#elif defined(VEC2_BATCH_SSE2)
+  struct SimdLanes
+  {
+    using Vector = __m128;
+    using Mask = __m128;
+    static constexpr std::size_t WIDTH = 4;
+
+    static Vector Load(const float *p) { return _mm_loadu_ps(p); }
+    static void Store(float *p, Vector v) { _mm_storeu_ps(p, v); }
+    static Vector Set(float v) { return _mm_set1_ps(v); }
+    static Vector Add(Vector a, Vector b) { return _mm_add_ps(a, b); }
+    static Vector Sub(Vector a, Vector b) { return _mm_sub_ps(a, b); }
+    static Vector Mul(Vector a, Vector b) { return _mm_mul_ps(a, b); }
+    static Vector Div(Vector a, Vector b) { return _mm_div_ps(a, b); }
+    static Vector Sqrt(Vector v) { return _mm_sqrt_ps(v); }
+    static Vector Min(Vector a, Vector b) { return _mm_min_ps(a, b); }
+    static Vector Max(Vector a, Vector b) { return _mm_max_ps(a, b); }
+    static Vector Abs(Vector v) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), v); }
+    // SSE2 has no round instruction; converting to int and back rounds to nearest (default MXCSR mode)
+    static Vector Round(Vector v) { return _mm_cvtepi32_ps(_mm_cvtps_epi32(v)); }
+    static Mask Greater(Vector a, Vector b) { return _mm_cmpgt_ps(a, b); }
+    static Mask Less(Vector a, Vector b) { return _mm_cmplt_ps(a, b); }
+    static Mask And(Mask a, Mask b) { return _mm_and_ps(a, b); }
+    static Vector Select(Mask m, Vector a, Vector b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+    static float Sum(Vector v)
+    {
+      alignas(16) float lanes[4];
+      _mm_store_ps(lanes, v);
+      return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+  };
+#elif defined(VEC2_BATCH_NEON)
+  struct SimdLanes
+  {
+    using Vector = float32x4_t;
+    using Mask = uint32x4_t;
+    static constexpr std::size_t WIDTH = 4;
+
+    static Vector Load(const float *p) { return vld1q_f32(p); }
+    static void Store(float *p, Vector v) { vst1q_f32(p, v); }
+    static Vector Set(float v) { return vdupq_n_f32(v); }
+    static Vector Add(Vector a, Vector b) { return vaddq_f32(a, b); }
+    static Vector Sub(Vector a, Vector b) { return vsubq_f32(a, b); }
+    static Vector Mul(Vector a, Vector b) { return vmulq_f32(a, b); }
+    static Vector Div(Vector a, Vector b) { return vdivq_f32(a, b); }
+    static Vector Sqrt(Vector v) { return vsqrtq_f32(v); }
+    static Vector Min(Vector a, Vector b) { return vminq_f32(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_f32(a, b); }
+    static Vector Abs(Vector v) { return vabsq_f32(v); }
+    static Vector Round(Vector v) { return vrndnq_f32(v); }
+    static Mask Greater(Vector a, Vector b) { return vcgtq_f32(a, b); }
+    static Mask Less(Vector a, Vector b) { return vcltq_f32(a, b); }
+    static Mask And(Mask a, Mask b) { return vandq_u32(a, b); }
+    static Vector Select(Mask m, Vector a, Vector b) { return vbslq_f32(m, a, b); }
+    static float Sum(Vector v)
+    {
+      float32x2_t pairs = vadd_f32(vget_low_f32(v), vget_high_f32(v));
+      return vget_lane_f32(vpadd_f32(pairs, pairs), 0);
+    }
+  };
+#else
+  using SimdLanes = ScalarLanes;
+#endif
+
+  // Run kernel(lanes, i) over [0, count): full SIMD registers first, then the leftovers one at a time
+  template <typename Kernel>
+  void ForEachBlock(std::size_t count, Kernel &&kernel)
+  {
+    std::size_t i = 0;
+    if constexpr (SimdLanes::WIDTH > 1)
+    {
+      for (; i + SimdLanes::WIDTH <= count; i += SimdLanes::WIDTH)
+        kernel(SimdLanes{}, i);
+    }
+    for (; i < count; ++i)
+      kernel(ScalarLanes{}, i);
+  }
+
+  // atan2 via an odd polynomial on [0, 1] (min(|x|,|y|) / max(|x|,|y|)), then fixed up per octant
+  template <typename L>
+  typename L::Vector Atan2(typename L::Vector y, typename L::Vector x)
+  {
+    const auto zero = L::Set(0.0f);
+    const auto absX = L::Abs(x);
+    const auto absY = L::Abs(y);
+
+    // atan2(0, 0) = 0: the max() keeps 0 / 0 from turning into NaN
+    auto ratio = L::Div(L::Min(absX, absY), L::Max(L::Max(absX, absY), L::Set(std::numeric_limits<float>::min())));
+    auto ratioSquared = L::Mul(ratio, ratio);
+
+    // Abramowitz & Stegun 4.4.49
+    auto poly = L::Add(L::Mul(L::Set(0.0208351f), ratioSquared), L::Set(-0.0851330f));
+    poly = L::Add(L::Mul(poly, ratioSquared), L::Set(0.1801410f));
+    poly = L::Add(L::Mul(poly, ratioSquared), L::Set(-0.3302995f));
+    poly = L::Add(L::Mul(poly, ratioSquared), L::Set(0.9998660f));
+    auto angle = L::Mul(poly, ratio);
+
+    angle = L::Select(L::Greater(absY, absX), L::Sub(L::Set(kHalfPi), angle), angle);
+    angle = L::Select(L::Less(x, zero), L::Sub(L::Set(kPi), angle), angle);
+    return L::Select(L::Less(y, zero), L::Sub(zero, angle), angle);
+  }
+
+  // sin(x) for x in [-π, π]: fold into [-π/2, π/2], then a degree-9 Taylor polynomial
+  template <typename L>
+  typename L::Vector SinReduced(typename L::Vector x)
+  {
+    x = L::Select(L::Greater(x, L::Set(kHalfPi)), L::Sub(L::Set(kPi), x), x);
+    x = L::Select(L::Less(x, L::Set(-kHalfPi)), L::Sub(L::Set(-kPi), x), x);
+
+    auto x2 = L::Mul(x, x);
+    auto poly = L::Add(L::Mul(L::Set(1.0f / 362880.0f), x2), L::Set(-1.0f / 5040.0f));
+    poly = L::Add(L::Mul(poly, x2), L::Set(1.0f / 120.0f));
+    poly = L::Add(L::Mul(poly, x2), L::Set(-1.0f / 6.0f));
+    poly = L::Add(L::Mul(poly, x2), L::Set(1.0f));
+    return L::Mul(poly, x);
+  }
+
+  template <typename L>
+  void SinCos(typename L::Vector angle, typename L::Vector &sine, typename L::Vector &cosine)
+  {
+    // Wrap into [-π, π]
+    auto turns = L::Round(L::Mul(angle, L::Set(kInverseTwoPi)));
+    auto x = L::Sub(angle, L::Mul(turns, L::Set(kTwoPiHigh)));
+    x = L::Sub(x, L::Mul(turns, L::Set(kTwoPiLow)));
+
+    // cos(x) = sin(x + π/2), wrapped back into [-π, π]
+    auto shifted = L::Add(x, L::Set(kHalfPi));
+    shifted = L::Select(L::Greater(shifted, L::Set(kPi)), L::Sub(shifted, L::Set(2.0f * kPi)), shifted);
+
+    sine = SinReduced<L>(x);
+    cosine = SinReduced<L>(shifted);
+  }
+}
+
+void Engine::Vec2Batch::Add(std::span<float> xs, std::span<float> ys,
+                            std::span<const float> otherXs, std::span<const float> otherYs)
+{
+  assert(xs.size() == ys.size() && otherXs.size() == xs.size() && otherYs.size() == xs.size() && "Vec2Batch spans must match in size");
+
+  ForEachBlock(xs.size(), [&](auto lanes, std::size_t i)
+               {
+                 using L = decltype(lanes);
+                 L::Store(&xs[i], L::Add(L::Load(&xs[i]), L::Load(&otherXs[i])));
+                 L::Store(&ys[i], L::Add(L::Load(&ys[i]), L::Load(&otherYs[i]))); });
+}
+
+void Engine::Vec2Batch::MulAdd(std::span<float> xs, std::span<float> ys,
+                               std::span<const float> otherXs, std::span<const float> otherYs, float scale)
+{
+  assert(xs.size() == ys.size() && otherXs.size() == xs.size() && otherYs.size() == xs.size() && "Vec2Batch spans must match in size");
+
+  // Separate multiply and add (no FMA), so results are bit-identical to `v += other * scale` on Vec2
+  ForEachBlock(xs.size(), [&](auto lanes, std::size_t i)
+               {
+                 using L = decltype(lanes);
+                 const auto factor = L::Set(scale);
+                 L::Store(&xs[i], L::Add(L::Load(&xs[i]), L::Mul(L::Load(&otherXs[i]), factor)));
+                 L::Store(&ys[i], L::Add(L::Load(&ys[i]), L::Mul(L::Load(&otherYs[i]), factor))); });
+}
+
+void Engine::Vec2Batch::Length(std::span<const float> xs, std::span<const float> ys, std::span<float> lengths)
+{
+  assert(xs.size() == ys.size() && lengths.size() == xs.size() && "Vec2Batch spans must match in size");
+
+  ForEachBlock(xs.size(), [&](auto lanes, std::size_t i)
+               {
+                 using L = decltype(lanes);
+                 auto x = L::Load(&xs[i]);
+                 auto y = L::Load(&ys[i]);
+                 L::Store(&lengths[i], L::Sqrt(L::Add(L::Mul(x, x), L::Mul(y, y)))); });
+}
+
+void Engine::Vec2Batch::Normalize(std::span<float> xs, std::span<float> ys)
+{
+  assert(xs.size() == ys.size() && "Vec2Batch spans must match in size");
+
+  ForEachBlock(xs.size(), [&](auto lanes, std::size_t i)
+               {
+                 using L = decltype(lanes);
+                 const auto zero = L::Set(0.0f);
+                 const auto minLengthSquared = L::Set(kMinLengthSquared);
+
+                 auto x = L::Load(&xs[i]);
+                 auto y = L::Load(&ys[i]);
+                 auto lengthSquared = L::Add(L::Mul(x, x), L::Mul(y, y));
+                 auto longEnough = L::Greater(lengthSquared, minLengthSquared);
+
+                 // Divide by the real sqrt (not an rsqrt estimate) so results match Vec2::normalize()
+                 auto length = L::Sqrt(L::Max(lengthSquared, minLengthSquared));
+                 L::Store(&xs[i], L::Select(longEnough, L::Div(x, length), zero));
+                 L::Store(&ys[i], L::Select(longEnough, L::Div(y, length), zero)); });
+}
+
+void Engine::Vec2Batch::Atan2(std::span<const float> ys, std::span<const float> xs, std::span<float> angles)
+{
+  assert(xs.size() == ys.size() && angles.size() == xs.size() && "Vec2Batch spans must match in size");
+
+  ForEachBlock(xs.size(), [&](auto lanes, std::size_t i)
+               {
+                 using L = decltype(lanes);
+                 L::Store(&angles[i], ::Atan2<L>(L::Load(&ys[i]), L::Load(&xs[i]))); });
+}
+
+void Engine::Vec2Batch::SinCos(std::span<const float> angles, std::span<float> sines, std::span<float> cosines)
+{
+  assert(sines.size() == angles.size() && cosines.size() == angles.size() && "Vec2Batch spans must match in size");
+
+  ForEachBlock(angles.size(), [&](auto lanes, std::size_t i)
+               {
+                 using L = decltype(lanes);
+                 typename L::Vector sine, cosine;
+                 ::SinCos<L>(L::Load(&angles[i]), sine, cosine);
+                 L::Store(&sines[i], sine);
+                 L::Store(&cosines[i], cosine); });
+}
+
+Engine::Vec2 Engine::Vec2Batch::Repulsion(const Vec2 &point, std::span<const float> xs, std::span<const float> ys, float radius)
+{
+  assert(xs.size() == ys.size() && "Vec2Batch spans must match in size");
+
+  // Each point pushes with offset / distance², so close points push much harder than far ones.
+  // Out-of-range lanes get weight 0 instead of a branch.
+  auto accumulate = [&](auto lanes, std::size_t i, auto &sumX, auto &sumY)
+  {
+    using L = decltype(lanes);
+    const auto minDistanceSquared = L::Set(kMinRepulsionDistanceSquared);
+
+    auto dx = L::Sub(L::Set(point.x), L::Load(&xs[i]));
+    auto dy = L::Sub(L::Set(point.y), L::Load(&ys[i]));
+    auto distanceSquared = L::Add(L::Mul(dx, dx), L::Mul(dy, dy));
+    auto inRange = L::And(L::Less(distanceSquared, L::Set(radius * radius)), L::Greater(distanceSquared, minDistanceSquared));
+    auto weight = L::Select(inRange, L::Div(L::Set(1.0f), L::Max(distanceSquared, minDistanceSquared)), L::Set(0.0f));
+
+    sumX = L::Add(sumX, L::Mul(dx, weight));
+    sumY = L::Add(sumY, L::Mul(dy, weight));
+  };
+
+  const std::size_t count = xs.size();
+  std::size_t i = 0;
+  Vec2 push;
+
+  if constexpr (SimdLanes::WIDTH > 1)
+  {
+    auto sumX = SimdLanes::Set(0.0f);
+    auto sumY = SimdLanes::Set(0.0f);
+    for (; i + SimdLanes::WIDTH <= count; i += SimdLanes::WIDTH)
+      accumulate(SimdLanes{}, i, sumX, sumY);
+    push = {SimdLanes::Sum(sumX), SimdLanes::Sum(sumY)};
+  }
+  for (; i < count; ++i)
+    accumulate(ScalarLanes{}, i, push.x, push.y);
+
+  return push;
+}
+
+float Engine::Vec2Batch::FastAtan2(float y, float x)
+{
+  return ::Atan2<ScalarLanes>(y, x);
+}
+
+void Engine::Vec2Batch::FastSinCos(float angle, float &sine, float &cosine)
+{
+  ::SinCos<ScalarLanes>(angle, sine, cosine);
+}
+
+const char *Engine::Vec2Batch::GetBackendName()
+{
+#if defined(VEC2_BATCH_AVX2)
+  return "AVX2";
+#elif defined(VEC2_BATCH_SSE2)
+  return "SSE2";
+#elif defined(VEC2_BATCH_NEON)
+  return "NEON";
+#else
+  return "Scalar";
+#endif
+}
@@ -0,0 +1,66 @@
+#include "game/DebugOverlay.h"
+
+#include <array>
+#include <cstdio>
+
+namespace
+{
+  constexpr float kMargin = 8.0f;
+  constexpr float kLineHeight = SDL_DEBUG_TEXT_FONT_CHARACTER_SIZE + 2.0f;
+  constexpr float kPanelWidth = 50 * SDL_DEBUG_TEXT_FONT_CHARACTER_SIZE; // Characters per line, in pixels
+
+  // Writes one line at a time, top to bottom
+  class TextCursor
+  {
+  public:
+    explicit TextCursor(SDL_Renderer *renderer) : _renderer(renderer) {}
+
+    template <typename... Args>
+    void Line(const char *format, Args... args)
+    {
+      std::array<char, 64> buffer{};
+      std::snprintf(buffer.data(), buffer.size(), format, args...); // Long lines are cut, not overflowed
+
+      SDL_RenderDebugText(_renderer, kMargin * 2.0f, _y, buffer.data());
+      _y += kLineHeight;
+    }
+
+  private:
+    SDL_Renderer *_renderer;
+    float _y = kMargin * 2.0f;
+  };
+}
+
+void DebugOverlay::Draw(SDL_Renderer *renderer, const Engine::Telemetry &telemetry)
+{
+  // Dark panel behind the text so it reads over any background
+  std::size_t lineCount = 6 + telemetry.systems.size() + telemetry.components.size() + telemetry.events.size();
+  SDL_FRect panel{kMargin, kMargin, kPanelWidth + kMargin * 2.0f, lineCount * kLineHeight + kMargin * 2.0f};
+  SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+  SDL_RenderFillRect(renderer, &panel);
+
+  SDL_SetRenderDrawColor(renderer, 230, 230, 230, 255);
+  TextCursor text(renderer);
+  text.Line("Entities %zu", telemetry.livingEntities);
+  text.Line("Frame: +%zu spawned, -%zu destroyed", telemetry.spawns, telemetry.destroys);
+  text.Line("       %zu signature changes", telemetry.signatureChanges);
+
+  text.Line("Systems");
+  for (const auto &system : telemetry.systems)
+  {
+    text.Line("  %-26.*s%8zu", static_cast<int>(system.name.size()), system.name.data(), system.entityCount);
+  }
+
+  text.Line("Components %zu KB", telemetry.componentBytes / 1024);
+  for (const auto &component : telemetry.components)
+  {
+    text.Line("  %-14.*s%7zu /%7zu %6zu KB", static_cast<int>(component.name.size()), component.name.data(),
+              component.size, component.capacity, component.bytes / 1024);
+  }
+
+  text.Line("Events (last frame)");
+  for (const auto &event : telemetry.events)
+  {
+    text.Line("  %-26.*s%8zu", static_cast<int>(event.name.size()), event.name.data(), event.count);
+  }
+}
@@ -0,0 +1,134 @@
+#include "game/Input.h"
+
+#include <SDL3/SDL.h>
+#include <array>
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+  constexpr std::array<char, 4> kMagic{'T', 'D', 'S', 'I'};
+  constexpr std::uint32_t kVersion = 1;
+  constexpr std::size_t kFrameSize = sizeof(std::uint8_t) + 2 * sizeof(float); // Packed on disk, no padding
+
+  template <typename T>
+  void WriteValue(std::ofstream &file, const T &value)
+  {
+    file.write(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  bool ReadValue(std::ifstream &file, T &value)
+  {
+    return static_cast<bool>(file.read(reinterpret_cast<char *>(&value), sizeof(T)));
+  }
+}
+
+Input::InputFrame Input::SampleLive()
+{
+  auto keyboardState = SDL_GetKeyboardState(nullptr);
+
+  float mouseX, mouseY;
+  auto mouseState = SDL_GetMouseState(&mouseX, &mouseY);
+
+  InputFrame frame;
+  if (keyboardState[SDL_SCANCODE_W])
+    frame.buttons |= MoveUp;
+  if (keyboardState[SDL_SCANCODE_S])
+    frame.buttons |= MoveDown;
+  if (keyboardState[SDL_SCANCODE_A])
+    frame.buttons |= MoveLeft;
+  if (keyboardState[SDL_SCANCODE_D])
+    frame.buttons |= MoveRight;
+  if (keyboardState[SDL_SCANCODE_E])
+    frame.buttons |= ZoomIn;
+  if (keyboardState[SDL_SCANCODE_Q])
+    frame.buttons |= ZoomOut;
+
+  // Fire intent is on when it detects the left mouse button.
+  if (mouseState & SDL_BUTTON_LMASK)
+    frame.buttons |= Fire;
+
+  frame.aimTarget = {mouseX, mouseY};
+  return frame;
+}
+
+// =======================================================
+
+bool Input::InputRecorder::Open(const std::string &filepath, float timestep)
+{
+  _file.open(filepath, std::ios::binary | std::ios::trunc);
+  if (!_file)
+  {
+    std::cerr << "InputRecorder::Open - Failed to create '" << filepath << "'\n";
+    return false;
+  }
+
+  _file.write(kMagic.data(), kMagic.size());
+  WriteValue(_file, kVersion);
+  WriteValue(_file, timestep);
+  return true;
+}
+
+void Input::InputRecorder::Write(const InputFrame &frame)
+{
+  // Write field by field so the struct's padding never ends up in the file
+  std::array<char, kFrameSize> bytes;
+  std::memcpy(bytes.data(), &frame.buttons, sizeof(std::uint8_t));
+  std::memcpy(bytes.data() + 1, &frame.aimTarget.x, sizeof(float));
+  std::memcpy(bytes.data() + 1 + sizeof(float), &frame.aimTarget.y, sizeof(float));
+  _file.write(bytes.data(), bytes.size());
+}
+
+bool Input::InputRecorder::IsOpen() const
+{
+  return _file.is_open();
+}
+
+// =======================================================
+
+bool Input::InputPlayback::Open(const std::string &filepath)
+{
+  _file.open(filepath, std::ios::binary);
+  if (!_file)
+  {
+    std::cerr << "InputPlayback::Open - Failed to open '" << filepath << "'\n";
+    return false;
+  }
+
+  std::array<char, 4> magic{};
+  std::uint32_t version = 0;
+  _file.read(magic.data(), magic.size());
+  if (!_file || magic != kMagic || !ReadValue(_file, version) || version != kVersion || !ReadValue(_file, _timestep))
+  {
+    std::cerr << "InputPlayback::Open - '" << filepath << "' is not a version " << kVersion << " input log\n";
+    _file.close();
+    return false;
+  }
+
+  return true;
+}
+
+bool Input::InputPlayback::Next(InputFrame &frame)
+{
+  std::array<char, kFrameSize> bytes;
+  if (!_file.read(bytes.data(), bytes.size()))
+  {
+    return false;
+  }
+
+  std::memcpy(&frame.buttons, bytes.data(), sizeof(std::uint8_t));
+  std::memcpy(&frame.aimTarget.x, bytes.data() + 1, sizeof(float));
+  std::memcpy(&frame.aimTarget.y, bytes.data() + 1 + sizeof(float), sizeof(float));
+  return true;
+}
+
+bool Input::InputPlayback::IsOpen() const
+{
+  return _file.is_open();
+}
+
+float Input::InputPlayback::GetTimestep() const
+{
+  return _timestep;
+}
@@ -0,0 +1,235 @@
+#include "game/Particles.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "engine/Vec2Batch.h"
+
+namespace
+{
+  // Fixed setup for each Particles::Emitter, in enum order
+  struct EmitterSetup
+  {
+    TextureID texture;
+    std::size_t maxParticles;
+    float drag;
+  };
+
+  constexpr EmitterSetup kEmitterSetups[] = {
+      {TextureID::Particle, 16384, 8.0f},  // MuzzleFlash: short, bright, stops fast
+      {TextureID::Particle, 131072, 3.0f}, // Sparks: every laser that hits or expires fizzles out
+  };
+  static_assert(std::size(kEmitterSetups) == static_cast<std::size_t>(Particles::Emitter::Count),
+                "Every emitter needs a setup");
+}
+
+Particles::Burst Particles::MuzzleFlash(const Engine::Vec2 &position, const Engine::Vec2 &direction)
+{
+  return {.position = position,
+          .direction = direction,
+          .spread = 0.5f,
+          .minSpeed = 60.0f,
+          .maxSpeed = 180.0f,
+          .minLifetime = 0.06f,
+          .maxLifetime = 0.14f,
+          .size = 6.0f,
+          .color = {1.0f, 0.85f, 0.5f, 1.0f},
+          .count = 6};
+}
+
+Particles::Burst Particles::Sparks(const Engine::Vec2 &position)
+{
+  return {.position = position,
+          .minSpeed = 30.0f,
+          .maxSpeed = 140.0f,
+          .minLifetime = 0.2f,
+          .maxLifetime = 0.45f,
+          .size = 4.0f,
+          .color = {0.6f, 0.9f, 1.0f, 1.0f},
+          .count = 8};
+}
+
+Particles::Burst Particles::Explosion(const Engine::Vec2 &position)
+{
+  return {.position = position,
+          .minSpeed = 60.0f,
+          .maxSpeed = 260.0f,
+          .minLifetime = 0.3f,
+          .maxLifetime = 0.7f,
+          .size = 6.0f,
+          .color = {1.0f, 0.55f, 0.2f, 1.0f},
+          .count = 32};
+}
+
+Particles::ParticleSystem::ParticleSystem()
+{
+  for (std::size_t i = 0; i < _pools.size(); ++i)
+  {
+    auto &pool = _pools[i];
+    const auto &setup = kEmitterSetups[i];
+    pool.texture = setup.texture;
+    pool.maxParticles = setup.maxParticles;
+    pool.drag = setup.drag;
+
+    // Allocate everything up front: emitting during play never touches the heap
+    pool.positionX.resize(setup.maxParticles);
+    pool.positionY.resize(setup.maxParticles);
+    pool.velocityX.resize(setup.maxParticles);
+    pool.velocityY.resize(setup.maxParticles);
+    pool.age.resize(setup.maxParticles);
+    pool.lifetime.resize(setup.maxParticles);
+    pool.size.resize(setup.maxParticles);
+    pool.color.resize(setup.maxParticles);
+  }
+}
+
+void Particles::ParticleSystem::Emit(Emitter emitter, const Burst &burst)
+{
+  assert(emitter < Emitter::Count && "Invalid particle emitter");
+  auto &pool = _pools[static_cast<std::size_t>(emitter)];
+
+  // A full pool just drops the rest of the burst: particles are decoration, not gameplay
+  const std::size_t count = std::min<std::size_t>(burst.count, pool.maxParticles - pool.count);
+  const float baseAngle = Engine::Vec2Batch::FastAtan2(burst.direction.y, burst.direction.x);
+
+  for (std::size_t n = 0; n < count; ++n)
+  {
+    const std::size_t i = pool.count++;
+
+    float angle = baseAngle + (NextRandom01() * 2.0f - 1.0f) * burst.spread;
+    float speed = burst.minSpeed + NextRandom01() * (burst.maxSpeed - burst.minSpeed);
+    float sine, cosine;
+    Engine::Vec2Batch::FastSinCos(angle, sine, cosine);
+
+    pool.positionX[i] = burst.position.x;
+    pool.positionY[i] = burst.position.y;
+    pool.velocityX[i] = cosine * speed;
+    pool.velocityY[i] = sine * speed;
+    pool.age[i] = 0.0f;
+    pool.lifetime[i] = burst.minLifetime + NextRandom01() * (burst.maxLifetime - burst.minLifetime);
+    pool.size[i] = burst.size;
+    pool.color[i] = burst.color;
+  }
+}
+
+void Particles::ParticleSystem::Update(float dt)
+{
+  for (auto &pool : _pools)
+  {
+    UpdatePool(pool, dt);
+  }
+}
+
+void Particles::ParticleSystem::UpdatePool(Pool &pool, float dt)
+{
+  // 1. Age everything (a plain loop over one array: the compiler vectorizes it)
+  for (std::size_t i = 0; i < pool.count; ++i)
+  {
+    pool.age[i] += dt;
+  }
+
+  // 2. Swap-remove the dead: move the last live particle into the hole. Order doesn't matter
+  //    for particles, and the live range stays packed so the next steps never skip anything.
+  std::size_t i = 0;
+  while (i < pool.count)
+  {
+    if (pool.age[i] < pool.lifetime[i])
+    {
+      ++i;
+      continue;
+    }
+
+    const std::size_t last = --pool.count;
+    pool.positionX[i] = pool.positionX[last];
+    pool.positionY[i] = pool.positionY[last];
+    pool.velocityX[i] = pool.velocityX[last];
+    pool.velocityY[i] = pool.velocityY[last];
+    pool.age[i] = pool.age[last];
+    pool.lifetime[i] = pool.lifetime[last];
+    pool.size[i] = pool.size[last];
+    pool.color[i] = pool.color[last];
+  }
+
+  // 3. Drag, then move: v += v * -(drag * dt), p += v * dt, several particles per instruction
+  const std::span<float> positionX(pool.positionX.data(), pool.count);
+  const std::span<float> positionY(pool.positionY.data(), pool.count);
+  const std::span<float> velocityX(pool.velocityX.data(), pool.count);
+  const std::span<float> velocityY(pool.velocityY.data(), pool.count);
+
+  const float damping = std::min(pool.drag * dt, 1.0f);
+  Engine::Vec2Batch::MulAdd(velocityX, velocityY, velocityX, velocityY, -damping);
+  Engine::Vec2Batch::MulAdd(positionX, positionY, velocityX, velocityY, dt);
+}
+
+void Particles::ParticleSystem::Extract(Rendering::RenderList &renderList, const Engine::Camera &camera) const
+{
+  if (renderList.geometry.size() < _pools.size())
+  {
+    renderList.geometry.resize(_pools.size());
+  }
+
+  const SDL_FRect view = camera.GetWorldView();
+  const float zoom = camera.GetZoom();
+
+  for (std::size_t p = 0; p < _pools.size(); ++p)
+  {
+    const auto &pool = _pools[p];
+    auto &batch = renderList.geometry[p];
+    batch.textureId = pool.texture;
+    batch.vertices.resize(pool.count * 4); // Worst case; trimmed to what's visible below
+
+    // Axis-aligned screen-space quads centred on each visible particle, fading out with age
+    std::size_t visible = 0;
+    for (std::size_t i = 0; i < pool.count; ++i)
+    {
+      const float x = pool.positionX[i];
+      const float y = pool.positionY[i];
+      if (x < view.x || x > view.x + view.w || y < view.y || y > view.y + view.h)
+        continue;
+
+      const Engine::Vec2 centre = camera.WorldToScreen({x, y});
+      const float half = pool.size[i] * 0.5f * zoom;
+      const float left = centre.x - half;
+      const float right = centre.x + half;
+      const float top = centre.y - half;
+      const float bottom = centre.y + half;
+
+      SDL_FColor color = pool.color[i];
+      color.a *= 1.0f - pool.age[i] / pool.lifetime[i];
+
+      SDL_Vertex *vertex = &batch.vertices[visible * 4];
+      vertex[0] = {{left, top}, color, {0.0f, 0.0f}};
+      vertex[1] = {{right, top}, color, {1.0f, 0.0f}};
+      vertex[2] = {{right, bottom}, color, {1.0f, 1.0f}};
+      vertex[3] = {{left, bottom}, color, {0.0f, 1.0f}};
+      ++visible;
+    }
+    batch.vertices.resize(visible * 4);
+
+    // Same two triangles for every quad, so indices are only written when the batch grows
+    for (std::size_t quad = batch.indices.size() / 6; quad < visible; ++quad)
+    {
+      const int first = static_cast<int>(quad * 4);
+      batch.indices.insert(batch.indices.end(), {first, first + 1, first + 2, first + 2, first + 3, first});
+    }
+    batch.indexCount = visible * 6;
+  }
+}
+
+std::size_t Particles::ParticleSystem::GetParticleCount() const
+{
+  std::size_t total = 0;
+  for (const auto &pool : _pools)
+  {
+    total += pool.count;
+  }
+  return total;
+}
+
+float Particles::ParticleSystem::NextRandom01()
+{
+  _randomState ^= _randomState << 13;
+  _randomState ^= _randomState >> 17;
+  _randomState ^= _randomState << 5;
+  return (_randomState >> 8) * (1.0f / 16777216.0f);
+}
@@ -0,0 +1,466 @@
+#include "game/Prefabs.h"
+#include "game/Components.h"
+#include "engine/Coordinator.h"
+
+#include <bitset>
+#include <charconv>
+#include <fstream>
+#include <initializer_list>
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+namespace
+{
+  // FieldReader hands out the "name=value" fields of one component line as typed values.
+  // Fields that are left out keep the value passed in; bad values and unknown names are errors.
+  class FieldReader
+  {
+  public:
+    explicit FieldReader(std::unordered_map<std::string, std::string> fields) : _fields(std::move(fields)) {}
+
+    void Read(const char *name, float &value)
+    {
+      if (const auto *text = Take(name); text && !ParseFloats(*text, &value, 1))
+        Fail(name, "a number");
+    }
+
+    void Read(const char *name, std::uint32_t &value)
+    {
+      const auto *text = Take(name);
+      if (!text)
+        return;
+      auto [end, error] = std::from_chars(text->data(), text->data() + text->size(), value);
+      if (error != std::errc() || end != text->data() + text->size())
+        Fail(name, "a whole number");
+    }
+
+    void Read(const char *name, bool &value)
+    {
+      ReadName(name, value, {{"true", true}, {"false", false}});
+    }
+
+    void Read(const char *name, Engine::Vec2 &value)
+    {
+      float xy[2];
+      if (const auto *text = Take(name); text && ParseList(name, *text, xy, 2))
+        value = {xy[0], xy[1]};
+    }
+
+    void Read(const char *name, SDL_FPoint &value)
+    {
+      float xy[2];
+      if (const auto *text = Take(name); text && ParseList(name, *text, xy, 2))
+        value = {xy[0], xy[1]};
+    }
+
+    void Read(const char *name, SDL_FRect &value)
+    {
+      float xywh[4];
+      if (const auto *text = Take(name); text && ParseList(name, *text, xywh, 4))
+        value = {xywh[0], xywh[1], xywh[2], xywh[3]};
+    }
+
+    void Read(const char *name, TextureID &value)
+    {
+      const auto *text = Take(name);
+      if (!text)
+        return;
+      auto texture = TextureNames.find(*text);
+      if (texture == TextureNames.end())
+        Fail(name, "a texture name from the texture manifest");
+      else
+        value = texture->second;
+    }
+
+    void Read(const char *name, SDL_FlipMode &value)
+    {
+      ReadName(name, value, {{"none", SDL_FLIP_NONE}, {"horizontal", SDL_FLIP_HORIZONTAL}, {"vertical", SDL_FLIP_VERTICAL}});
+    }
+
+    void Read(const char *name, Components::RenderLayer &value)
+    {
+      using Components::RenderLayer;
+      ReadName(name, value, {{"Ground", RenderLayer::Ground},
+                             {"Projectiles", RenderLayer::Projectiles},
+                             {"Ships", RenderLayer::Ships},
+                             {"Overlay", RenderLayer::Overlay}});
+    }
+
+    // Call once every field has been read: reports the first bad value, or any field nobody asked for
+    bool Finish(std::string &error)
+    {
+      if (_error.empty() && !_fields.empty())
+        _error = "unknown field '" + _fields.begin()->first + "'";
+      error = _error;
+      return _error.empty();
+    }
+
+  private:
+    // The field's text, removed so Finish() can tell which fields were never read
+    const std::string *Take(const char *name)
+    {
+      auto field = _fields.find(name);
+      if (field == _fields.end())
+        return nullptr;
+      _taken = std::move(field->second);
+      _fields.erase(field);
+      return &_taken;
+    }
+
+    template <typename T>
+    void ReadName(const char *name, T &value, std::initializer_list<std::pair<const char *, T>> choices)
+    {
+      const auto *text = Take(name);
+      if (!text)
+        return;
+      for (const auto &[choice, choiceValue] : choices)
+      {
+        if (*text == choice)
+        {
+          value = choiceValue;
+          return;
+        }
+      }
+      Fail(name, "one of the listed names");
+    }
+
+    bool ParseList(const char *name, const std::string &text, float *values, std::size_t count)
+    {
+      if (ParseFloats(text, values, count))
+        return true;
+      Fail(name, count == 2 ? "x,y" : "x,y,w,h");
+      return false;
+    }
+
+    // Exactly `count` comma-separated numbers
+    static bool ParseFloats(const std::string &text, float *values, std::size_t count)
+    {
+      const char *cursor = text.data();
+      const char *end = text.data() + text.size();
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        if (i > 0)
+        {
+          if (cursor == end || *cursor != ',')
+            return false;
+          ++cursor;
+        }
+        auto result = std::from_chars(cursor, end, values[i]);
+        if (result.ec != std::errc())
+          return false;
+        cursor = result.ptr;
+      }
+      return cursor == end;
+    }
+
+    void Fail(const char *name, const char *expected)
+    {
+      if (_error.empty())
+        _error = std::string("field '") + name + "' should be " + expected;
+    }
+
+    std::unordered_map<std::string, std::string> _fields;
+    std::string _taken;
+    std::string _error;
+  };
+
+  // TemplateBuilder adds components to the template being compiled, for the Coordinator it belongs to.
+  struct TemplateBuilder
+  {
+    Engine::Coordinator &coordinator;
+    Engine::SpawnTemplate &spawnTemplate;
+
+    template <typename T>
+    void Add(const T &component)
+    {
+      coordinator.SetTemplateComponent(spawnTemplate, component);
+    }
+  };
+
+  // One parser per component the prefab file may use: start from the component's defaults, then apply the fields
+  using ComponentParser = void (*)(FieldReader &fields, TemplateBuilder &builder);
+
+  const std::unordered_map<std::string, ComponentParser> kComponentParsers = {
+      {"Transform", [](FieldReader &fields, TemplateBuilder &builder)
+       {
+         Components::Transform transform;
+         fields.Read("position", transform.position);
+         fields.Read("rotation", transform.rotation);
+         fields.Read("scale", transform.scale);
+         builder.Add(transform);
+       }},
+      {"Velocity", [](FieldReader &fields, TemplateBuilder &builder)
+       {
+         Components::Velocity velocity;
+         fields.Read("vector", velocity.vector);
+         builder.Add(velocity);
+       }},
+      {"Sprite", [](FieldReader &fields, TemplateBuilder &builder)
+       {
+         Components::Sprite sprite{.srcRect = {0.0f, 0.0f, 0.0f, 0.0f},
+                                   .flipMode = SDL_FLIP_NONE,
+                                   .textureId = TextureID::Player};
+         fields.Read("srcRect", sprite.srcRect);
+         fields.Read("flipMode", sprite.flipMode);
+         fields.Read("textureId", sprite.textureId);
+         fields.Read("layer", sprite.layer);
+         builder.Add(sprite);
+       }},
+      {"Pivot", [](FieldReader &fields, TemplateBuilder &builder)
+       {
+         Components::Pivot pivot{.point = {0.0f, 0.0f}};
+         fields.Read("point", pivot.point);
+         builder.Add(pivot);
+       }},
+      {"Speed", [](FieldReader &fields, TemplateBuilder &builder)
+       {
+         Components::Speed speed{.value = 0.0f};
+         fields.Read("value", speed.value);
+         builder.Add(speed);
+       }},
+      {"Damage", [](FieldReader &fields, TemplateBuilder &builder)
+       {
+         Components::Damage damage{.value = 0.0f};
+         fields.Read("value", damage.value);
+         builder.Add(damage);
+       }},
+      {"Health", [](FieldReader &fields, TemplateBuilder &builder)
+       {
+         Components::Health health{.current = 1.0f, .max = 1.0f};
+         fields.Read("current", health.current);
+         fields.Read("max", health.max);
+         builder.Add(health);
+       }},
+      {"Collider", [](FieldReader &fields, TemplateBuilder &builder)
+       {
+         Components::Collider collider{.radius = 0.0f};
+         fields.Read("radius", collider.radius);
+         builder.Add(collider);
+       }},
+      {"Lifetime", [](FieldReader &fields, TemplateBuilder &builder)
+       {
+         Components::Lifetime lifetime{.remaining = 0.0f};
+         fields.Read("remaining", lifetime.remaining);
+         builder.Add(lifetime);
+       }},
+      {"Cooldown", [](FieldReader &fields, TemplateBuilder &builder)
+       {
+         Components::Cooldown cooldown{.remaining = 0.0f};
+         fields.Read("remaining", cooldown.remaining);
+         builder.Add(cooldown);
+       }},
+      {"MoveIntent", [](FieldReader &fields, TemplateBuilder &builder)
+       {
+         Components::MoveIntent moveIntent;
+         fields.Read("direction", moveIntent.direction);
+         builder.Add(moveIntent);
+       }},
+      {"AimIntent", [](FieldReader &fields, TemplateBuilder &builder)
+       {
+         Components::AimIntent aimIntent;
+         fields.Read("target", aimIntent.target);
+         fields.Read("direction", aimIntent.direction);
+         builder.Add(aimIntent);
+       }},
+      {"FireIntent", [](FieldReader &fields, TemplateBuilder &builder)
+       {
+         Components::FireIntent fireIntent;
+         fields.Read("active", fireIntent.active);
+         builder.Add(fireIntent);
+       }},
+      {"WeaponStats", [](FieldReader &fields, TemplateBuilder &builder)
+       {
+         Components::WeaponStats weaponStats{.fireRate = 1.0f,
+                                             .projectileSpeed = 0.0f,
+                                             .projectileDamage = 0.0f,
+                                             .projectileLifetime = 0.0f,
+                                             .projectileOffset = 0.0f};
+         fields.Read("fireRate", weaponStats.fireRate);
+         fields.Read("projectileSpeed", weaponStats.projectileSpeed);
+         fields.Read("projectileDamage", weaponStats.projectileDamage);
+         fields.Read("projectileLifetime", weaponStats.projectileLifetime);
+         fields.Read("projectileOffset", weaponStats.projectileOffset);
+         builder.Add(weaponStats);
+       }},
+      {"WeaponVisuals", [](FieldReader &fields, TemplateBuilder &builder)
+       {
+         Components::WeaponVisuals weaponVisuals{.projectileSrcRect = {0.0f, 0.0f, 0.0f, 0.0f},
+                                                 .projectilePivotPoint = {0.0f, 0.0f},
+                                                 .projectileTexture = TextureID::LaserBeam};
+         fields.Read("projectileTexture", weaponVisuals.projectileTexture);
+         fields.Read("projectileSrcRect", weaponVisuals.projectileSrcRect);
+         fields.Read("projectilePivotPoint", weaponVisuals.projectilePivotPoint);
+         builder.Add(weaponVisuals);
+       }},
+      {"AISteering", [](FieldReader &fields, TemplateBuilder &builder)
+       {
+         Components::AISteering steering;
+         fields.Read("seekWeight", steering.seekWeight);
+         fields.Read("separationWeight", steering.separationWeight);
+         fields.Read("wanderWeight", steering.wanderWeight);
+         fields.Read("wanderAngle", steering.wanderAngle);
+         fields.Read("randomState", steering.randomState);
+         builder.Add(steering);
+       }},
+      {"Player", [](FieldReader &, TemplateBuilder &builder)
+       { builder.Add(Components::Player{}); }},
+      {"Weapon", [](FieldReader &, TemplateBuilder &builder)
+       { builder.Add(Components::Weapon{}); }},
+      {"Enemy", [](FieldReader &, TemplateBuilder &builder)
+       { builder.Add(Components::Enemy{}); }},
+  };
+
+  template <typename Component>
+  bool HasComponent(Engine::Coordinator &coordinator, const Engine::SpawnTemplate &spawnTemplate)
+  {
+    return coordinator.GetTemplateComponent<Component>(spawnTemplate).has_value();
+  }
+
+  // RequiredComponent is one component EntityCreator writes right after spawning a prefab. A prefab
+  // without it would fail on its first spawn, so Load() rejects the file instead.
+  struct RequiredComponent
+  {
+    const char *prefab; // Section name, as in PrefabNames
+    const char *component;
+    bool (*isPresent)(Engine::Coordinator &, const Engine::SpawnTemplate &);
+  };
+
+  const RequiredComponent kRequiredComponents[] = {
+      {"player", "Transform", HasComponent<Components::Transform>},
+      {"turret", "Transform", HasComponent<Components::Transform>},
+      {"turret", "AimIntent", HasComponent<Components::AimIntent>},
+      {"enemy", "Transform", HasComponent<Components::Transform>},
+      {"enemy", "AISteering", HasComponent<Components::AISteering>},
+      {"projectile", "Transform", HasComponent<Components::Transform>},
+      {"projectile", "Sprite", HasComponent<Components::Sprite>},
+      {"projectile", "Pivot", HasComponent<Components::Pivot>},
+      {"projectile", "Velocity", HasComponent<Components::Velocity>},
+      {"projectile", "Damage", HasComponent<Components::Damage>},
+      {"projectile", "Lifetime", HasComponent<Components::Lifetime>},
+  };
+}
+
+bool Prefabs::PrefabLibrary::Load(Engine::Coordinator &coordinator, const std::string &filepath)
+{
+  std::ifstream file(filepath);
+  if (!file)
+  {
+    std::cerr << "PrefabLibrary::Load - Failed to open '" << filepath << "'\n";
+    return false;
+  }
+
+  // Compile into a fresh set, so a broken file leaves the current templates alone
+  std::array<Engine::SpawnTemplate, static_cast<std::size_t>(PrefabID::Count)> templates;
+  std::bitset<static_cast<std::size_t>(PrefabID::Count)> defined;
+  Engine::SpawnTemplate *current = nullptr;
+  bool valid = true;
+
+  auto report = [&](int lineNumber, const std::string &message)
+  {
+    std::cerr << "PrefabLibrary::Load - " << filepath << ":" << lineNumber << ": " << message << "\n";
+    valid = false;
+  };
+
+  std::string line;
+  int lineNumber = 0;
+  while (std::getline(file, line))
+  {
+    ++lineNumber;
+    std::istringstream tokens(line);
+    std::string first;
+    if (!(tokens >> first) || first.starts_with('#'))
+      continue; // Blank line or comment
+
+    // [name] starts a new prefab
+    if (first.starts_with('['))
+    {
+      auto prefab = PrefabNames.end();
+      if (first.size() > 2 && first.ends_with(']'))
+        prefab = PrefabNames.find(first.substr(1, first.size() - 2));
+      if (prefab == PrefabNames.end())
+      {
+        report(lineNumber, "unknown prefab '" + first + "'");
+        current = nullptr;
+        continue;
+      }
+
+      auto index = static_cast<std::size_t>(prefab->second);
+      templates[index] = {};
+      defined.set(index);
+      current = &templates[index];
+      continue;
+    }
+
+    // Component line: "Name field=value field=value ..."
+    auto parser = kComponentParsers.find(first);
+    if (parser == kComponentParsers.end())
+    {
+      report(lineNumber, "unknown component '" + first + "'");
+      continue;
+    }
+    if (!current)
+    {
+      report(lineNumber, "component '" + first + "' is outside of a [prefab] section");
+      continue;
+    }
+
+    std::unordered_map<std::string, std::string> fields;
+    std::string field;
+    while (tokens >> field)
+    {
+      auto equals = field.find('=');
+      if (equals == std::string::npos || equals == 0)
+      {
+        report(lineNumber, "expected field=value, got '" + field + "'");
+        continue;
+      }
+      fields[field.substr(0, equals)] = field.substr(equals + 1);
+    }
+
+    FieldReader reader(std::move(fields));
+    TemplateBuilder builder{coordinator, *current};
+    parser->second(reader, builder);
+    if (std::string error; !reader.Finish(error))
+    {
+      report(lineNumber, first + ": " + error);
+    }
+  }
+
+  for (const auto &[name, id] : PrefabNames)
+  {
+    if (!defined.test(static_cast<std::size_t>(id)))
+    {
+      std::cerr << "PrefabLibrary::Load - " << filepath << ": missing prefab [" << name << "]\n";
+      valid = false;
+    }
+  }
+
+  // RenderSystem only draws entities that have both
+  for (const auto &[name, id] : PrefabNames)
+  {
+    const auto &spawnTemplate = templates[static_cast<std::size_t>(id)];
+    if (HasComponent<Components::Sprite>(coordinator, spawnTemplate) && !HasComponent<Components::Pivot>(coordinator, spawnTemplate))
+    {
+      std::cerr << "PrefabLibrary::Load - " << filepath << ": prefab [" << name << "] has a Sprite but no Pivot, so it would never be drawn\n";
+      valid = false;
+    }
+  }
+
+  for (const auto &required : kRequiredComponents)
+  {
+    auto index = static_cast<std::size_t>(PrefabNames.at(required.prefab));
+    if (defined.test(index) && !required.isPresent(coordinator, templates[index]))
+    {
+      std::cerr << "PrefabLibrary::Load - " << filepath << ": prefab [" << required.prefab
+                << "] needs a " << required.component << " component\n";
+      valid = false;
+    }
+  }
+
+  if (!valid)
+    return false;
+
+  _templates = std::move(templates);
+  return true;
+}
@@ -0,0 +1,148 @@
+#include "game/StressTest.h"
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <numeric>
+#include <print>
+
+#include "engine/Coordinator.h"
+#include "game/EntityCreator.h"
+
+StressTest::StressScenario::StressScenario(Engine::Coordinator &coordinator, const Prefabs::PrefabLibrary &prefabs,
+                                           const StressConfig &config, Engine::Vec2 areaSize)
+    : _coordinator(coordinator),
+      _prefabs(prefabs),
+      _config(config),
+      _areaSize(areaSize),
+      _random(config.seed),
+      _targetEntities(config.startEntities),
+      _maxEntities(static_cast<std::size_t>(Engine::MAX_ENTITIES * config.capacityFraction))
+{
+  _targetEntities = std::min(_targetEntities, _maxEntities);
+  _samples.reserve(_config.measureTicks);
+}
+
+bool StressTest::StressScenario::Open()
+{
+  _csv.open(_config.csvPath, std::ios::trunc);
+  if (!_csv)
+  {
+    std::cerr << "StressScenario::Open - Failed to create '" << _config.csvPath << "'\n";
+    return false;
+  }
+
+  _csv << "target_entities,live_entities,turrets,"
+          "sim_ms_avg,sim_ms_p95,sim_ms_max,"
+          "render_ms_avg,render_ms_p95,render_ms_max,"
+          "frame_ms_avg,frame_ms_p95,frame_ms_max\n";
+  return true;
+}
+
+void StressTest::StressScenario::Update()
+{
+  if (_finished || _stepTick != 0)
+    return;
+
+  // Start of a step: add enough turrets that their steady-state population hits the target
+  std::size_t perTurret = EstimateEntitiesPerTurret();
+  std::size_t wantedTurrets = _targetEntities / perTurret;
+  if (wantedTurrets > _turretCount)
+  {
+    SpawnTurrets(wantedTurrets - _turretCount);
+  }
+}
+
+void StressTest::StressScenario::RecordFrame(double simulationMs, double renderMs, double frameMs)
+{
+  if (_finished)
+    return;
+
+  ++_stepTick;
+  if (_stepTick <= _config.warmupTicks)
+    return;
+
+  _samples.push_back({simulationMs, renderMs, frameMs});
+  if (_samples.size() < _config.measureTicks)
+    return;
+
+  WriteStepRow();
+
+  // Move on to the next step (or stop once we've measured at capacity)
+  if (_targetEntities >= _maxEntities)
+  {
+    _finished = true;
+    std::println("Stress test finished, results written to {}", _config.csvPath);
+    return;
+  }
+
+  _targetEntities = std::min(_maxEntities, static_cast<std::size_t>(_targetEntities * _config.growthFactor));
+  _stepTick = 0;
+  _samples.clear();
+}
+
+bool StressTest::StressScenario::IsFinished() const
+{
+  return _finished;
+}
+
+void StressTest::StressScenario::SpawnTurrets(std::size_t count)
+{
+  std::uniform_real_distribution<float> randomX(0.0f, _areaSize.x);
+  std::uniform_real_distribution<float> randomY(0.0f, _areaSize.y);
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    // Aim somewhere else in the area so projectiles cross the screen
+    EntityCreator::CreateTurret(_coordinator, _prefabs,
+                                {.position = {randomX(_random), randomY(_random)},
+                                 .aimTarget = {randomX(_random), randomY(_random)}});
+  }
+  _turretCount += count;
+}
+
+// Turret + weapon, plus one projectile per shot that is still alive (lifetime / fireRate)
+std::size_t StressTest::StressScenario::EstimateEntitiesPerTurret() const
+{
+  auto weaponStats = _coordinator.GetTemplateComponent<Components::WeaponStats>(_prefabs.Get(Prefabs::PrefabID::LaserWeapon));
+  if (!weaponStats || weaponStats->fireRate <= 0.0f)
+    return 2;
+
+  return 2 + static_cast<std::size_t>(weaponStats->projectileLifetime / weaponStats->fireRate);
+}
+
+void StressTest::StressScenario::WriteStepRow()
+{
+  // avg, p95, max of one column
+  auto summarize = [this](double FrameSample::*field)
+  {
+    std::vector<double> values;
+    values.reserve(_samples.size());
+    for (const auto &sample : _samples)
+    {
+      values.push_back(sample.*field);
+    }
+    std::sort(values.begin(), values.end());
+
+    double average = std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+    double p95 = values[std::min(values.size() - 1, values.size() * 95 / 100)];
+    return std::array<double, 3>{average, p95, values.back()};
+  };
+
+  auto simulation = summarize(&FrameSample::simulationMs);
+  auto render = summarize(&FrameSample::renderMs);
+  auto frame = summarize(&FrameSample::frameMs);
+
+  _csv << _targetEntities << ',' << _coordinator.GetEntityCount() << ',' << _turretCount;
+  for (const auto &column : {simulation, render, frame})
+  {
+    for (double value : column)
+    {
+      _csv << ',' << value;
+    }
+  }
+  _csv << '\n';
+  _csv.flush(); // Keep partial results if the run is killed
+
+  std::println("Stress step: {} entities, sim {:.3f} ms, render {:.3f} ms", _targetEntities, simulation[0], render[0]);
+}
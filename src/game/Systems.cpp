@@ -1,59 +1,149 @@
 #include "game/Systems.h"
-#include <iostream>
-
-inline Engine::Vec2 GetSpriteCenter(const Engine::Entity &entity)
+#include "engine/RadixSort.h"
+#include "engine/Vec2Batch.h"
+#include <algorithm>
+#include <limits>
+#include <memory_resource>
+#include <vector>
+
+inline Engine::Vec2 GetSpriteCenter(Engine::Coordinator &coordinator, const Engine::Entity &entity)
 {
-  auto &coordinator = Engine::Coordinator::GetInstance();
   auto *transform = coordinator.GetOptional<Components::Transform>(entity);
-  auto *sprite = coordinator.GetOptional<Components::Sprite>(entity);
+  auto *pivot = coordinator.GetOptional<Components::Pivot>(entity);
 
-  if (transform && sprite)
+  if (transform && pivot)
   {
-    return transform->position + Engine::Vec2{sprite->pivotPoint.x * transform->scale.x, sprite->pivotPoint.y * transform->scale.y};
+    return transform->position + Engine::Vec2{pivot->point.x * transform->scale.x, pivot->point.y * transform->scale.y};
   }
 
   return transform->position;
 }
 
+namespace
+{
+  /**
+   * Draw order key, compared as one integer:
+   *   bits 56-63  render layer       (higher layers on top)
+   *   bits 48-55  texture            (same-texture sprites end up adjacent, so SDL can batch them)
+   *   bits 32-47  depth              (bottom edge y: lower on screen draws in front)
+   *   bits  0-31  command index      (ties keep extraction order)
+   */
+  std::uint64_t MakeSortKey(Components::RenderLayer layer, TextureID texture, float bottomY, std::uint32_t index)
+  {
+    // Shift y so the whole [-32768, 32767] pixel range maps to an unsigned 16-bit depth
+    float depth = std::clamp(bottomY + 32768.0f, 0.0f, 65535.0f);
+
+    return (static_cast<std::uint64_t>(layer) << 56) |
+           (static_cast<std::uint64_t>(static_cast<std::uint8_t>(texture)) << 48) |
+           (static_cast<std::uint64_t>(depth) << 32) |
+           index;
+  }
+
+  // xorshift32: tiny deterministic random numbers, so replays see the same wander
+  float NextRandom01(std::uint32_t &state)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return (state >> 8) * (1.0f / 16777216.0f);
+  }
+}
+
 void Systems::RenderSystem::Init(SDL_Renderer *renderer, Engine::TextureManager *textureManager)
 {
   _renderer = renderer;
   _textureManager = textureManager;
 }
 
-void Systems::RenderSystem::Update()
+void Systems::RenderSystem::Extract(Engine::Coordinator &coordinator, Rendering::RenderList &renderList, const Engine::Camera &camera) const
 {
-  auto &coordinator = Engine::Coordinator::GetInstance();
+  auto *arena = &coordinator.GetFrameArena();
 
-  // Iterate through all entities that have Transform and Sprite components
-  for (const auto &entity : _entities)
+  renderList.Clear();
+  renderList.camera = camera;
+
+  const SDL_FRect view = camera.GetWorldView();
+  const float zoom = camera.GetZoom();
+
+  // Commands are built in entity order (which changes as entities come and go), each with a
+  // sort key that says where it really belongs
+  const std::size_t count = _entities.size();
+  std::pmr::vector<Rendering::SpriteCommand> commands(arena);
+  std::pmr::vector<std::uint64_t> sortKeys(arena);
+  commands.reserve(count);
+  sortKeys.reserve(count);
+
+  // Every entity with Transform, Sprite and Pivot, co-sorted: index i is the same entity in every span
+  auto group = coordinator.GetGroup<Components::Transform, Components::Sprite, Components::Pivot>();
+  auto transforms = group.Get<Components::Transform>();
+  auto sprites = group.Get<Components::Sprite>();
+  auto pivots = group.Get<Components::Pivot>();
+
+  for (std::size_t i = 0; i < group.size(); ++i)
   {
-    auto &transform = coordinator.Get<Components::Transform>(entity);
-    auto &sprite = coordinator.Get<Components::Sprite>(entity);
-    auto *texture = _textureManager->Get(sprite.textureId);
+    const auto &transform = transforms[i];
+    const auto &sprite = sprites[i];
 
-    // Figure out where to draw the sprite and how big it should be.
-    SDL_FRect dstRect;
-    dstRect.x = transform.position.x;
-    dstRect.y = transform.position.y;
-    dstRect.w = sprite.srcRect.w * transform.scale.x;
-    dstRect.h = sprite.srcRect.h * transform.scale.y;
+    // Figure out where the sprite is in the world and how big it is.
+    float width = sprite.srcRect.w * transform.scale.x;
+    float height = sprite.srcRect.h * transform.scale.y;
 
-    // Render it with its rotation and any flip that sprite needs.
-    SDL_RenderTextureRotated(_renderer, texture, &sprite.srcRect, &dstRect,
-                             transform.rotation, &sprite.pivotPoint, sprite.flipMode);
+    // Cull anything off screen. Rotation can swing a sprite around its pivot, so pad by its larger side.
+    float margin = std::max(width, height);
+    if (transform.position.x + width + margin < view.x || transform.position.x - margin > view.x + view.w ||
+        transform.position.y + height + margin < view.y || transform.position.y - margin > view.y + view.h)
+      continue;
+
+    // Convert to screen space for the renderer.
+    Engine::Vec2 topLeft = camera.WorldToScreen(transform.position);
+    SDL_FRect dstRect{topLeft.x, topLeft.y, width * zoom, height * zoom};
+
+    sortKeys.push_back(MakeSortKey(sprite.layer, sprite.textureId, transform.position.y + height,
+                                   static_cast<std::uint32_t>(commands.size())));
+    commands.push_back({.textureId = sprite.textureId,
+                        .srcRect = sprite.srcRect,
+                        .dstRect = dstRect,
+                        .rotation = transform.rotation,
+                        .pivotPoint = {pivots[i].point.x * zoom, pivots[i].point.y * zoom},
+                        .flipMode = sprite.flipMode});
+  }
+
+  // Sort on the top 32 bits only: the low 32 are the command index, already ascending
+  std::pmr::vector<std::uint64_t> sortScratch(sortKeys.size(), arena);
+  Engine::RadixSort(sortKeys, sortScratch, 4);
+
+  // Same-texture commands now sit next to each other, so SDL can batch them
+  for (std::uint64_t key : sortKeys)
+  {
+    renderList.sprites.push_back(commands[key & 0xFFFFFFFFu]);
   }
 }
 
-void Systems::PlayerInputSystem::Update()
+void Systems::RenderSystem::Draw(const Rendering::RenderList &renderList) const
 {
-  auto keyboardState = SDL_GetKeyboardState(nullptr);
+  for (const auto &command : renderList.sprites)
+  {
+    auto *texture = _textureManager->Get(command.textureId);
 
-  float mouseX, mouseY;
-  auto mouseState = SDL_GetMouseState(&mouseX, &mouseY);
+    // Render it with its rotation and any flip that sprite needs.
+    SDL_RenderTextureRotated(_renderer, texture, &command.srcRect, &command.dstRect,
+                             command.rotation, &command.pivotPoint, command.flipMode);
+  }
 
-  auto &coordinator = Engine::Coordinator::GetInstance();
+  // One call per batch, however many quads it holds (particles)
+  for (const auto &batch : renderList.geometry)
+  {
+    if (batch.indexCount == 0)
+      continue;
+
+    SDL_RenderGeometry(_renderer, _textureManager->Get(batch.textureId),
+                       batch.vertices.data(), static_cast<int>(batch.vertices.size()),
+                       batch.indices.data(), static_cast<int>(batch.indexCount));
+  }
+}
 
+void Systems::PlayerInputSystem::Update(Engine::Coordinator &coordinator, const Input::InputFrame &input, const Engine::Camera &camera)
+{
   for (const auto &entity : _entities)
   {
     auto &moveIntent = coordinator.Get<Components::MoveIntent>(entity);
@@ -63,19 +153,19 @@ void Systems::PlayerInputSystem::Update()
     // Reset the movement direction before checking the keys.
     moveIntent.direction = {0.0f, 0.0f};
 
-    if (keyboardState[SDL_SCANCODE_W])
+    if (input.IsDown(Input::MoveUp))
     {
       moveIntent.direction += Directions::UP;
     }
-    if (keyboardState[SDL_SCANCODE_S])
+    if (input.IsDown(Input::MoveDown))
     {
       moveIntent.direction += Directions::DOWN;
     }
-    if (keyboardState[SDL_SCANCODE_A])
+    if (input.IsDown(Input::MoveLeft))
     {
       moveIntent.direction += Directions::LEFT;
     }
-    if (keyboardState[SDL_SCANCODE_D])
+    if (input.IsDown(Input::MoveRight))
     {
       moveIntent.direction += Directions::RIGHT;
     }
@@ -83,16 +173,14 @@ void Systems::PlayerInputSystem::Update()
     // Normalize so diagonal feels as fast as moving straight.
     moveIntent.direction.normalize();
 
-    aimIntent.target = {mouseX, mouseY};
-    // Fire intent is on when it detects the left mouse button.
-    fireIntent.active = (mouseState & SDL_BUTTON_LMASK);
+    // The cursor is in screen space; aiming happens in the world.
+    aimIntent.target = camera.ScreenToWorld(input.aimTarget);
+    fireIntent.active = input.IsDown(Input::Fire);
   }
 }
 
-void Systems::VelocitySystem::Update()
+void Systems::VelocitySystem::Update(Engine::Coordinator &coordinator)
 {
-  auto &coordinator = Engine::Coordinator::GetInstance();
-
   for (const auto &entity : _entities)
   {
     auto &moveIntent = coordinator.Get<Components::MoveIntent>(entity);
@@ -103,89 +191,334 @@ void Systems::VelocitySystem::Update()
   }
 }
 
-void Systems::MovementSystem::Update(float dt)
+void Systems::MovementSystem::Update(Engine::Coordinator &coordinator, float dt)
 {
-  auto &coordinator = Engine::Coordinator::GetInstance();
+  auto *arena = &coordinator.GetFrameArena();
 
-  for (const auto &entity : _entities)
-  {
-    auto &transform = coordinator.Get<Components::Transform>(entity);
-    auto &velocity = coordinator.Get<Components::Velocity>(entity);
+  const std::size_t count = _entities.size();
+  std::pmr::vector<Components::Transform *> transforms(count, arena);
+  std::pmr::vector<float> positionX(count, arena), positionY(count, arena);
+  std::pmr::vector<float> velocityX(count, arena), velocityY(count, arena);
 
-    // Move the transform by the current velocity scaled by delta time.
-    transform.position += velocity.vector * dt;
+  auto gather = [&](std::size_t i, Components::Transform &transform, const Components::Velocity &velocity)
+  {
+    transforms[i] = &transform;
+    positionX[i] = transform.position.x;
+    positionY[i] = transform.position.y;
+    velocityX[i] = velocity.vector.x;
+    velocityY[i] = velocity.vector.y;
+  };
+
+  // Movers with a sprite (all of them, in practice) come from a group, so both arrays are read in order
+  auto group = coordinator.GetGroup<Components::Transform, Components::Sprite, Components::Pivot, Components::Velocity>();
+  auto groupTransforms = group.Get<Components::Transform>();
+  auto groupVelocities = group.Get<Components::Velocity>();
+
+  std::size_t i = 0;
+  for (; i < group.size(); ++i)
+    gather(i, groupTransforms[i], groupVelocities[i]);
+
+  // Any mover without a sprite is outside the group: look its components up one by one
+  if (i < count)
+  {
+    for (const auto &entity : _entities)
+    {
+      if (!coordinator.GetOptional<Components::Sprite>(entity) || !coordinator.GetOptional<Components::Pivot>(entity))
+      {
+        gather(i, coordinator.Get<Components::Transform>(entity), coordinator.Get<Components::Velocity>(entity));
+        ++i;
+      }
+    }
   }
+
+  // Move every transform by its velocity scaled by delta time, several at once.
+  Engine::Vec2Batch::MulAdd(positionX, positionY, velocityX, velocityY, dt);
+
+  for (i = 0; i < count; ++i)
+    transforms[i]->position = {positionX[i], positionY[i]};
 }
 
-void Systems::AimSystem::Update()
+void Systems::AimSystem::Update(Engine::Coordinator &coordinator)
 {
-  auto &coordinator = Engine::Coordinator::GetInstance();
+  auto *arena = &coordinator.GetFrameArena();
 
   constexpr float kSpriteFacingOffsetDegrees = 90.0f; // Sprite faces right by default, so rotate +90 degrees.
   constexpr float kRadiansToDegrees = 180.0f / M_PI;  // Convert SDL angles from radians to degrees.
 
+  const std::size_t count = _entities.size();
+  std::pmr::vector<Components::Transform *> transforms(count, arena);
+  std::pmr::vector<float> directionX(count, arena), directionY(count, arena), angles(count, arena);
+
+  std::size_t i = 0;
   for (const auto &entity : _entities)
   {
-    auto &transform = coordinator.Get<Components::Transform>(entity);
+    transforms[i] = &coordinator.Get<Components::Transform>(entity);
     auto &aimIntent = coordinator.Get<Components::AimIntent>(entity);
 
-    Engine::Vec2 entityCenter = GetSpriteCenter(entity);
+    Engine::Vec2 entityCenter = GetSpriteCenter(coordinator, entity);
 
     // Compute the direction from the sprite's center to the cursor.
     aimIntent.direction = aimIntent.target - entityCenter;
-
-    auto angleInDegrees = std::atan2(aimIntent.direction.y, aimIntent.direction.x) * kRadiansToDegrees;
-    transform.rotation = angleInDegrees;
+    directionX[i] = aimIntent.direction.x;
+    directionY[i] = aimIntent.direction.y;
+    ++i;
   }
+
+  // Approximate atan2 is plenty for a sprite angle (~1e-5 rad), and does every aimer in one pass
+  Engine::Vec2Batch::Atan2(directionY, directionX, angles);
+
+  for (i = 0; i < count; ++i)
+    transforms[i]->rotation = angles[i] * kRadiansToDegrees;
 }
 
-void Systems::WeaponSystem::Update()
+Engine::JobTask Systems::SteeringSystem::Update(Engine::Coordinator &coordinator, Engine::JobSystem &jobs, float dt, Engine::Vec2 target,
+                                                const Engine::FlowField *flowField)
 {
-  auto &coordinator = Engine::Coordinator::GetInstance();
+  auto *arena = &coordinator.GetFrameArena();
+
+  constexpr float kWanderJitter = 4.0f; // Max wander turn rate (radians per second)
+
+  const std::size_t count = _entities.size();
+  if (count == 0)
+    co_return;
+
+  // SoA scratch buffers for this tick, straight from the frame arena
+  std::pmr::vector<float> positionX(count, arena), positionY(count, arena);
+  std::pmr::vector<float> seekX(count, arena), seekY(count, arena);
+  std::pmr::vector<float> separationX(count, 0.0f, arena), separationY(count, 0.0f, arena);
+  std::pmr::vector<float> steerX(count, arena), steerY(count, arena);
+  std::pmr::vector<float> wanderAngle(count, arena);
 
+  // 1. Gather positions, and compute the wander part (needs per-agent random state, so it stays scalar)
+  std::size_t i = 0;
   for (const auto &entity : _entities)
   {
-    auto &ownedBy = coordinator.Get<Components::OwnedBy>(entity);
-    // Grab the fire intent from whoever owns this weapon.
-    auto &fireIntent = coordinator.Get<Components::FireIntent>(ownedBy.owner);
-    // Cooldown that keeps the weapon from firing until it runs out.
-    auto &cooldown = coordinator.Get<Components::Cooldown>(entity);
+    auto &transform = coordinator.Get<Components::Transform>(entity);
+    auto &steering = coordinator.Get<Components::AISteering>(entity);
 
-    if (cooldown.remaining > 0.0f)
-      continue;
+    positionX[i] = transform.position.x;
+    positionY[i] = transform.position.y;
+
+    steering.wanderAngle += (NextRandom01(steering.randomState) - 0.5f) * 2.0f * kWanderJitter * dt;
+    wanderAngle[i] = steering.wanderAngle;
+    ++i;
+  }
+  Engine::Vec2Batch::SinCos(wanderAngle, steerY, steerX); // Unit wander direction, weighted in the blend below
+
+  // 2. Seek: follow the flow field (O(1) lookup), or head straight for the target where it has no answer
+  //    (goal cell, off the grid, or the first field is still being built)
+  for (i = 0; i < count; ++i)
+  {
+    Engine::Vec2 flow = flowField ? flowField->Sample({positionX[i], positionY[i]}) : Engine::Vec2{};
+    bool hasFlow = (flow.x != 0.0f || flow.y != 0.0f);
 
+    seekX[i] = hasFlow ? flow.x : target.x - positionX[i];
+    seekY[i] = hasFlow ? flow.y : target.y - positionY[i];
+  }
+  Engine::Vec2Batch::Normalize(seekX, seekY);
+
+  // 3. Separation: only look at agents in the 3x3 grid cells around each agent.
+  //    Each agent reads the grid and writes only its own slot, so chunks of agents run in parallel
+  //    (and the result doesn't depend on how they were split).
+  _grid.Build(positionX, positionY);
+  std::span<const float> sortedX = _grid.GetSortedX();
+  std::span<const float> sortedY = _grid.GetSortedY();
+
+  auto separate = [&](std::size_t begin, std::size_t end)
+  {
+    for (std::size_t agent = begin; agent < end; ++agent)
+    {
+      Engine::Vec2 position{positionX[agent], positionY[agent]};
+      Engine::Vec2 push;
+      _grid.ForEachCellNear(position.x, position.y, [&](Engine::SpatialGrid::CellRange range)
+                            { push += Engine::Vec2Batch::Repulsion(position,
+                                                                   sortedX.subspan(range.begin, range.end - range.begin),
+                                                                   sortedY.subspan(range.begin, range.end - range.begin),
+                                                                   SEPARATION_RADIUS); });
+
+      // Scale by the radius so an agent right at the edge pushes with strength ~1, like seek
+      separationX[agent] = push.x * SEPARATION_RADIUS;
+      separationY[agent] = push.y * SEPARATION_RADIUS;
+    }
+  };
+  Engine::JobCounter separated;
+  jobs.ParallelFor(separated, count, SEPARATION_CHUNK_SIZE, separate);
+  co_await separated;
+
+  // 4. Blend the three behaviors, normalize, and write the move intents back
+  i = 0;
+  for (const auto &entity : _entities)
+  {
+    auto &steering = coordinator.Get<Components::AISteering>(entity);
+    steerX[i] = steerX[i] * steering.wanderWeight + seekX[i] * steering.seekWeight + separationX[i] * steering.separationWeight;
+    steerY[i] = steerY[i] * steering.wanderWeight + seekY[i] * steering.seekWeight + separationY[i] * steering.separationWeight;
+    ++i;
+  }
+  Engine::Vec2Batch::Normalize(steerX, steerY);
+
+  i = 0;
+  for (const auto &entity : _entities)
+  {
+    coordinator.Get<Components::MoveIntent>(entity).direction = {steerX[i], steerY[i]};
+    ++i;
+  }
+}
+
+void Systems::WeaponSystem::Update(Engine::Coordinator &coordinator, const Prefabs::PrefabLibrary &prefabs)
+{
+  auto &shotsFired = coordinator.GetEvents().GetQueue<Events::ShotFired>();
+
+  // Weapons are children of the ship that carries them: read the ship's intent, aim and position
+  // once, then fire every weapon it has.
+  auto fireWeapons = [&](Engine::Entity owner, std::span<const Engine::Entity> weapons)
+  {
     // Skip unless the owner actually wants to fire.
-    if (fireIntent.active)
+    if (!coordinator.Get<Components::FireIntent>(owner).active)
+      return;
+
+    // Aim direction used when spawning the projectiles.
+    auto &aimIntent = coordinator.Get<Components::AimIntent>(owner);
+    if (!aimIntent.direction.normalize())
     {
-      auto &weaponStats = coordinator.Get<Components::WeaponStats>(entity);
-      // Owner transform keeps the projectile's rotation aligned.
-      auto &transform = coordinator.Get<Components::Transform>(ownedBy.owner);
-      // Aim direction used when spawning the projectile.
-      auto &aimIntent = coordinator.Get<Components::AimIntent>(ownedBy.owner);
+      coordinator.GetEvents().Emit(Events::AimFailed{owner});
+      return;
+    }
 
-      if (aimIntent.direction.normalize())
-      {
-        // Figure out the spawn position from the owner's center and aim.
-        auto entityCenter = GetSpriteCenter(ownedBy.owner);
-        auto projectilePosition = entityCenter + (aimIntent.direction * weaponStats.projectileOffset);
+    // Owner transform keeps the projectile's rotation aligned.
+    float rotation = coordinator.Get<Components::Transform>(owner).rotation;
+    auto ownerCenter = GetSpriteCenter(coordinator, owner);
 
-        EntityCreator::CreateProjectile(projectilePosition, aimIntent.direction, weaponStats, transform.rotation);
+    for (Engine::Entity weapon : weapons)
+    {
+      // Cooldown that keeps the weapon from firing until it runs out.
+      auto &cooldown = coordinator.Get<Components::Cooldown>(weapon);
+      if (cooldown.remaining > 0.0f)
+        continue;
 
-        // Reset the cooldown so it won't fire again immediately after.
-        cooldown.remaining = weaponStats.fireRate;
-      }
-      else
-      {
-        std::cerr << "Invalid aim direction for weapon " << entity << std::endl;
-      }
+      // Entity pool is full: skip the shot instead of asserting in CreateEntity.
+      if (coordinator.GetEntityCount() >= Engine::MAX_ENTITIES)
+        return;
+
+      // Figure out the spawn position from the owner's center and aim.
+      auto &weaponStats = coordinator.Get<Components::WeaponStats>(weapon);
+      auto projectilePosition = ownerCenter + (aimIntent.direction * weaponStats.projectileOffset);
+
+      // Visuals are cold: only looked up for a weapon that is actually firing this tick
+      auto *weaponVisuals = coordinator.GetOptional<Components::WeaponVisuals>(weapon);
+
+      EntityCreator::CreateProjectile(coordinator, prefabs, projectilePosition, aimIntent.direction, weaponStats, weaponVisuals, rotation);
+      shotsFired.Emit({weapon, projectilePosition, aimIntent.direction});
+
+      // Reset the cooldown so it won't fire again immediately after.
+      cooldown.remaining = weaponStats.fireRate;
     }
+  };
+  coordinator.ForEachChildGroup(_entities, fireWeapons);
+}
+
+std::span<const Events::Hit> Systems::CollisionSystem::Update(Engine::Coordinator &coordinator, const Engine::EntitySet &targets)
+{
+  auto *arena = &coordinator.GetFrameArena();
+
+  _hits.clear();
+  if (targets.empty() || _entities.empty())
+    return _hits;
+
+  // 1. Targets into the grid: SoA centres, and each one's radius and entity by original index
+  const std::size_t targetCount = targets.size();
+  std::pmr::vector<float> targetX(targetCount, arena), targetY(targetCount, arena), radius(targetCount, arena);
+  std::pmr::vector<Engine::Entity> targetEntity(targetCount, arena);
+
+  std::size_t i = 0;
+  for (const auto &target : targets)
+  {
+    Engine::Vec2 center = GetSpriteCenter(coordinator, target);
+    targetX[i] = center.x;
+    targetY[i] = center.y;
+    radius[i] = std::min(coordinator.Get<Components::Collider>(target).radius, MAX_TARGET_RADIUS);
+    targetEntity[i] = target;
+    ++i;
   }
+  _grid.Build(targetX, targetY);
+  std::span<const float> sortedX = _grid.GetSortedX();
+  std::span<const float> sortedY = _grid.GetSortedY();
+  std::span<const std::uint32_t> sortedIndex = _grid.GetSortedIndices();
+
+  // 2. Every projectile against the targets around it: the nearest one it overlaps takes the hit
+  constexpr std::uint32_t kNoTarget = ~0u;
+  for (const auto &projectile : _entities)
+  {
+    Engine::Vec2 position = GetSpriteCenter(coordinator, projectile);
+
+    float nearest = std::numeric_limits<float>::max();
+    std::uint32_t hit = kNoTarget;
+    _grid.ForEachCellNear(position.x, position.y, [&](Engine::SpatialGrid::CellRange range)
+                          {
+                            for (std::uint32_t slot = range.begin; slot < range.end; ++slot)
+                            {
+                              float dx = sortedX[slot] - position.x;
+                              float dy = sortedY[slot] - position.y;
+                              float distanceSquared = dx * dx + dy * dy;
+                              float targetRadius = radius[sortedIndex[slot]];
+                              if (distanceSquared <= targetRadius * targetRadius && distanceSquared < nearest)
+                              {
+                                nearest = distanceSquared;
+                                hit = sortedIndex[slot];
+                              }
+                            }
+                          });
+    if (hit == kNoTarget)
+      continue;
+
+    _hits.push_back({projectile, targetEntity[hit], coordinator.Get<Components::Damage>(projectile).value, position});
+    coordinator.DestroyDeferred(projectile); // Still in _entities: destroying now would break this loop
+  }
+
+  coordinator.GetEvents().Emit(std::span<const Events::Hit>(_hits));
+  return _hits;
 }
 
-void Systems::CooldownSystem::Update(float dt)
+void Systems::DamageSystem::Update(Engine::Coordinator &coordinator, std::span<const Events::Hit> hits)
 {
-  auto &coordinator = Engine::Coordinator::GetInstance();
+  if (hits.empty())
+    return;
 
+  auto &healthArray = coordinator.GetPackedArray<Components::Health>();
+  const std::size_t count = healthArray.Size();
+  std::pmr::vector<float> damage(count, 0.0f, &coordinator.GetFrameArena());
+
+  // 1. Scatter-add: a target hit many times this tick just accumulates in its one slot
+  for (const auto &hit : hits)
+  {
+    std::size_t index = healthArray.IndexOf(hit.target);
+    if (index < count) // Skip targets that lost their Health (or were destroyed) since the hit
+      damage[index] += hit.damage;
+  }
+
+  // 2. Apply: one straight pass over the packed healths, no lookups
+  Components::Health *healths = healthArray.GetPackedData();
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    healths[index].current -= damage[index];
+  }
+
+  // 3. Whatever took damage and is now at zero died this tick (the dead never outlive the tick they died in)
+  const Engine::Entity *owners = healthArray.GetPackedEntities();
+  auto &died = coordinator.GetEvents().GetQueue<Events::Died>();
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    if (damage[index] > 0.0f && healths[index].current <= 0.0f)
+    {
+      Engine::Entity entity = owners[index];
+      Engine::Vec2 position = coordinator.GetOptional<Components::Transform>(entity) ? GetSpriteCenter(coordinator, entity) : Engine::Vec2{};
+      died.Emit({entity, position});
+      coordinator.DestroyDeferred(entity);
+    }
+  }
+}
+
+void Systems::CooldownSystem::Update(Engine::Coordinator &coordinator, float dt)
+{
   // Knock down each cooldown timer and clamp it at zero.
   for (const auto &entity : _entities)
   {
@@ -196,12 +529,12 @@ void Systems::CooldownSystem::Update(float dt)
   }
 }
 
-void Systems::LifetimeSystem::Update(float dt)
+void Systems::LifetimeSystem::Update(Engine::Coordinator &coordinator, float dt)
 {
-  auto &coordinator = Engine::Coordinator::GetInstance();
-
   // Collect the entities that should disappear this frame.
-  std::vector<Engine::Entity> entitiesToDestroy;
+  // Scratch list lives in the frame arena, so this doesn't touch the heap.
+  std::pmr::vector<Engine::Entity> entitiesToDestroy(&coordinator.GetFrameArena());
+  entitiesToDestroy.reserve(_entities.size());
 
   for (const auto &entity : _entities)
   {
@@ -217,8 +550,13 @@ void Systems::LifetimeSystem::Update(float dt)
   }
 
   // Destroy them afterward so no loop runs into invalid handles.
+  auto &expired = coordinator.GetEvents().GetQueue<Events::Expired>();
   for (const auto &entity : entitiesToDestroy)
   {
+    if (coordinator.GetOptional<Components::Transform>(entity))
+    {
+      expired.Emit({entity, GetSpriteCenter(coordinator, entity)});
+    }
     coordinator.DestroyEntity(entity);
   }
 }
@@ -1,10 +1,55 @@
 #include <SDL3/SDL.h>
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
 #include "Game.h"
 
 int main(int argc, char *argv[])
 {
+  Game::Options options;
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string_view arg = argv[i];
+    if (arg == "--record" && i + 1 < argc)
+    {
+      options.recordInputPath = argv[++i];
+    }
+    else if (arg == "--replay" && i + 1 < argc)
+    {
+      options.replayInputPath = argv[++i];
+    }
+    else if (arg == "--load-snapshot" && i + 1 < argc)
+    {
+      options.loadSnapshotPath = argv[++i];
+    }
+    else if (arg == "--save-snapshot" && i + 1 < argc)
+    {
+      options.saveSnapshotPath = argv[++i];
+    }
+    else if (arg == "--stress" && i + 1 < argc)
+    {
+      options.stressCsvPath = argv[++i];
+    }
+    else if (arg == "--enemies" && i + 1 < argc)
+    {
+      options.enemyCount = std::strtoul(argv[++i], nullptr, 10);
+    }
+    else if (arg == "--telemetry")
+    {
+      options.showTelemetry = true;
+    }
+    else
+    {
+      std::cerr << "Unknown argument: " << arg << "\n"
+                << "Usage: " << argv[0] << " [--record <file> | --replay <file>]"
+                << " [--load-snapshot <file>] [--save-snapshot <file>] [--stress <csv file>]"
+                << " [--enemies <count>] [--telemetry]\n";
+      return 1;
+    }
+  }
+
   Game game;
-  if (!game.Init()) return 1;
+  if (!game.Init(options)) return 1;
   game.Run();
   return 0;
 }
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include "engine/Vec2Batch.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+/*
+ * Vec2BatchTest: checks every Vec2Batch op against the standard library and the scalar Vec2 versions
+ *
+ * Sizes are chosen so each op runs both full SIMD registers and a scalar tail. Tolerances are the
+ * documented ones for the approximations (Atan2 ~1.2e-5 rad, SinCos ~4e-6), and a few float ulps
+ * for the exact ops. Prints every value out of tolerance, and exits non-zero if there was any.
+ */
+namespace
+{
+  constexpr float ATAN2_TOLERANCE = 2e-5f;   // Documented max error ~1.2e-5 rad
+  constexpr float SINCOS_TOLERANCE = 1e-5f;  // Documented max error ~4e-6
+  constexpr float EXACT_TOLERANCE = 1e-5f;   // Relative, for ops that are plain float arithmetic
+  constexpr std::size_t COUNT = 1003;        // Not a multiple of 4 or 8, so the tail is covered
+
+  int gFailures = 0;
+
+  void Check(const char *op, std::size_t i, float actual, float expected, float tolerance)
+  {
+    float error = std::fabs(actual - expected);
+    if (!(error <= tolerance * std::max(1.0f, std::fabs(expected))))
+    {
+      std::printf("FAIL %s[%zu]: got %.9g, expected %.9g (error %.3g, tolerance %.3g)\n",
+                  op, i, actual, expected, error, tolerance);
+      ++gFailures;
+    }
+  }
+
+  std::vector<float> RandomFloats(std::mt19937 &random, float low, float high)
+  {
+    std::uniform_real_distribution<float> distribution(low, high);
+    std::vector<float> values(COUNT);
+    for (auto &value : values)
+      value = distribution(random);
+    return values;
+  }
+}
+
+int main()
+{
+  std::mt19937 random(1234);
+  std::printf("Vec2Batch backend: %s\n", Engine::Vec2Batch::GetBackendName());
+
+  auto xs = RandomFloats(random, -500.0f, 500.0f);
+  auto ys = RandomFloats(random, -500.0f, 500.0f);
+  auto otherXs = RandomFloats(random, -50.0f, 50.0f);
+  auto otherYs = RandomFloats(random, -50.0f, 50.0f);
+
+  // Add / MulAdd against Vec2's operators
+  {
+    auto sumXs = xs, sumYs = ys;
+    auto mulAddXs = xs, mulAddYs = ys;
+    Engine::Vec2Batch::Add(sumXs, sumYs, otherXs, otherYs);
+    Engine::Vec2Batch::MulAdd(mulAddXs, mulAddYs, otherXs, otherYs, 0.016f);
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+      Engine::Vec2 sum = Engine::Vec2{xs[i], ys[i]} + Engine::Vec2{otherXs[i], otherYs[i]};
+      Engine::Vec2 mulAdd = Engine::Vec2{xs[i], ys[i]} + Engine::Vec2{otherXs[i], otherYs[i]} * 0.016f;
+      Check("Add.x", i, sumXs[i], sum.x, EXACT_TOLERANCE);
+      Check("Add.y", i, sumYs[i], sum.y, EXACT_TOLERANCE);
+      Check("MulAdd.x", i, mulAddXs[i], mulAdd.x, EXACT_TOLERANCE);
+      Check("MulAdd.y", i, mulAddYs[i], mulAdd.y, EXACT_TOLERANCE);
+    }
+  }
+
+  // Length / Normalize against the scalar formula and Vec2::normalize(), including a zero vector
+  {
+    auto normalXs = xs, normalYs = ys;
+    normalXs[7] = 0.0f;
+    normalYs[7] = 0.0f;
+    std::vector<float> lengths(COUNT);
+    Engine::Vec2Batch::Length(normalXs, normalYs, lengths);
+    Engine::Vec2Batch::Normalize(normalXs, normalYs);
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+      Engine::Vec2 vector = i == 7 ? Engine::Vec2{} : Engine::Vec2{xs[i], ys[i]};
+      Check("Length", i, lengths[i], std::sqrt(vector.x * vector.x + vector.y * vector.y), EXACT_TOLERANCE);
+
+      Engine::Vec2 normal = vector;
+      if (!normal.normalize())
+        normal = {}; // Batch version zeroes what it can't normalize
+      Check("Normalize.x", i, normalXs[i], normal.x, EXACT_TOLERANCE);
+      Check("Normalize.y", i, normalYs[i], normal.y, EXACT_TOLERANCE);
+    }
+  }
+
+  // Atan2 against std::atan2, over every quadrant and the axes
+  {
+    auto atanXs = xs, atanYs = ys;
+    atanXs[0] = 0.0f;  atanYs[0] = 1.0f;
+    atanXs[1] = -1.0f; atanYs[1] = 0.0f;
+    atanXs[2] = 1.0f;  atanYs[2] = 0.0f;
+    atanXs[3] = 0.0f;  atanYs[3] = -1.0f;
+    std::vector<float> angles(COUNT);
+    Engine::Vec2Batch::Atan2(atanYs, atanXs, angles);
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+      float expected = std::atan2(atanYs[i], atanXs[i]);
+      Check("Atan2", i, angles[i], expected, ATAN2_TOLERANCE);
+      Check("FastAtan2", i, Engine::Vec2Batch::FastAtan2(atanYs[i], atanXs[i]), expected, ATAN2_TOLERANCE);
+    }
+  }
+
+  // SinCos against std::sin / std::cos, over several turns either way (wander angles drift freely)
+  {
+    auto angles = RandomFloats(random, -20.0f, 20.0f);
+    std::vector<float> sines(COUNT), cosines(COUNT);
+    Engine::Vec2Batch::SinCos(angles, sines, cosines);
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+      Check("SinCos.sin", i, sines[i], std::sin(angles[i]), SINCOS_TOLERANCE);
+      Check("SinCos.cos", i, cosines[i], std::cos(angles[i]), SINCOS_TOLERANCE);
+
+      float sine = 0.0f, cosine = 0.0f;
+      Engine::Vec2Batch::FastSinCos(angles[i], sine, cosine);
+      Check("FastSinCos.sin", i, sine, std::sin(angles[i]), SINCOS_TOLERANCE);
+      Check("FastSinCos.cos", i, cosine, std::cos(angles[i]), SINCOS_TOLERANCE);
+    }
+  }
+
+  // Repulsion against a plain Vec2 loop with the same rule (offset / distance², inside the radius)
+  {
+    constexpr float radius = 48.0f;
+    auto nearXs = RandomFloats(random, -60.0f, 60.0f);
+    auto nearYs = RandomFloats(random, -60.0f, 60.0f);
+    Engine::Vec2 point{3.0f, -2.0f};
+    nearXs[5] = point.x; // The point itself is skipped
+    nearYs[5] = point.y;
+
+    Engine::Vec2 expected;
+    for (std::size_t i = 0; i < COUNT; ++i)
+    {
+      Engine::Vec2 offset = point - Engine::Vec2{nearXs[i], nearYs[i]};
+      float distanceSquared = offset.x * offset.x + offset.y * offset.y;
+      if (distanceSquared < radius * radius && distanceSquared > 1e-6f)
+        expected += offset * (1.0f / distanceSquared);
+    }
+
+    Engine::Vec2 push = Engine::Vec2Batch::Repulsion(point, nearXs, nearYs, radius);
+    Check("Repulsion.x", 0, push.x, expected.x, 1e-4f); // Summed in a different order across lanes
+    Check("Repulsion.y", 0, push.y, expected.y, 1e-4f);
+  }
+
+  if (gFailures > 0)
+  {
+    std::printf("%d check(s) failed\n", gFailures);
+    return 1;
+  }
+  std::printf("All Vec2Batch checks passed\n");
+  return 0;
+}